@@ -0,0 +1,295 @@
+// =============================================================================
+// VOXEL ENGINE - MICROBENCHMARK SUITE
+// Reproducible hot-kernel benchmarks: meshing, chunk bulk scans, world
+// voxel access under concurrent readers, raycasting, and mesh queue
+// throughput. Fixed seeds (WorldConfig::seed) keep runs comparable
+// across commits. Reports ns/op plus chunk/s for chunk-sized work.
+// =============================================================================
+
+#include "Shared/Chunk.hpp"
+#include "Shared/Raycast.hpp"
+#include "Server/World.hpp"
+#include "Server/GeneratorRegistry.hpp"
+#include "Client/MeshGenerator.hpp"
+#include "Client/MeshTaskQueue.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using BenchClock = std::chrono::steady_clock;
+
+constexpr std::uint64_t BENCH_SEED = 1337;
+
+// =============================================================================
+// HARNESS
+// Runs the workload after a warmup pass and reports ns per operation.
+// items_per_op > 1 scales the secondary rate column (e.g. voxels/ray).
+// =============================================================================
+template <typename F>
+void run_bench(const char* name, std::size_t iterations, F&& op) {
+    // Warmup: touch caches and let any lazy state settle
+    const std::size_t warmup = iterations / 10 + 1;
+    for (std::size_t i = 0; i < warmup; ++i) {
+        op(i);
+    }
+
+    const auto start = BenchClock::now();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        op(i);
+    }
+    const auto end = BenchClock::now();
+
+    const double total_ns = std::chrono::duration<double, std::nano>(end - start).count();
+    const double ns_per_op = total_ns / static_cast<double>(iterations);
+    const double ops_per_s = 1e9 / ns_per_op;
+
+    std::printf("%-36s %10zu iters %12.1f ns/op %12.0f op/s\n",
+                name, iterations, ns_per_op, ops_per_s);
+}
+
+// Keep results observable so -O3 cannot discard the measured work
+volatile std::uint64_t g_sink = 0;
+
+// =============================================================================
+// FIXTURE CHUNKS
+// =============================================================================
+
+// Fixtures fill a caller-owned chunk in place: Chunk is pinned once
+// constructed (the move constructor is deleted), so factories cannot
+// return one by value.
+
+// Alternating stone/air in a 3D checkerboard - worst case for face
+// culling (every solid voxel exposes all six faces)
+void fill_checkerboard_chunk(voxel::Chunk& chunk) {
+    chunk.allocate();
+    voxel::Voxel* data = chunk.data();
+    for (voxel::VoxelIndex i = 0; i < voxel::Chunk::VOLUME; ++i) {
+        const std::uint32_t x = i >> 12;
+        const std::uint32_t z = (i >> 6) & 63u;
+        const std::uint32_t y = i & 63u;
+        data[i] = ((x + y + z) & 1u) ? voxel::Voxel(voxel::VoxelType::STONE) : voxel::Voxel();
+    }
+}
+
+// Seeded rolling heightfield with dirt/grass layering - representative
+// of generated terrain without depending on a specific generator
+void fill_terrain_chunk(voxel::Chunk& chunk) {
+    chunk.allocate();
+    std::mt19937_64 rng(BENCH_SEED);
+    std::uniform_int_distribution<std::uint32_t> jitter(0, 3);
+
+    voxel::Voxel* data = chunk.data();
+    for (std::uint32_t x = 0; x < 64; ++x) {
+        for (std::uint32_t z = 0; z < 64; ++z) {
+            const std::uint32_t height = 24
+                + ((x * 13 + z * 7) % 11)
+                + jitter(rng);
+            for (std::uint32_t y = 0; y < 64; ++y) {
+                voxel::Voxel v;
+                if (y + 4 < height) {
+                    v = voxel::Voxel(voxel::VoxelType::STONE);
+                } else if (y + 1 < height) {
+                    v = voxel::Voxel(voxel::VoxelType::DIRT);
+                } else if (y < height) {
+                    v = voxel::Voxel(voxel::VoxelType::GRASS);
+                }
+                data[voxel::coord::to_index(
+                    static_cast<voxel::LocalCoord>(x),
+                    static_cast<voxel::LocalCoord>(y),
+                    static_cast<voxel::LocalCoord>(z))] = v;
+            }
+        }
+    }
+}
+
+// =============================================================================
+// BENCHMARKS
+// =============================================================================
+
+void bench_mesh_generator() {
+    voxel::client::MeshGenerator generator;
+    voxel::client::ChunkMesh mesh;
+
+    voxel::Chunk empty({0, 0, 0});
+    empty.allocate();
+    (void)empty.data();  // Dense so is_empty takes the scan, not the tier shortcut
+
+    voxel::Chunk checkerboard({0, 0, 0});
+    fill_checkerboard_chunk(checkerboard);
+    voxel::Chunk terrain({0, 0, 0});
+    fill_terrain_chunk(terrain);
+
+    run_bench("mesh_generate/empty", 2000, [&](std::size_t) {
+        generator.generate_simple(empty, mesh);
+        g_sink = g_sink + (mesh.quad_count);
+    });
+    run_bench("mesh_generate/checkerboard", 50, [&](std::size_t) {
+        generator.generate_simple(checkerboard, mesh);
+        g_sink = g_sink + (mesh.quad_count);
+    });
+    run_bench("mesh_generate/terrain", 500, [&](std::size_t) {
+        generator.generate_simple(terrain, mesh);
+        g_sink = g_sink + (mesh.quad_count);
+    });
+}
+
+void bench_chunk_scans() {
+    voxel::Chunk chunk({0, 0, 0});
+    fill_terrain_chunk(chunk);
+
+    run_bench("chunk/count_solid", 5000, [&](std::size_t) {
+        g_sink = g_sink + (chunk.count_solid());
+    });
+    run_bench("chunk/is_empty", 5000, [&](std::size_t) {
+        g_sink = g_sink + (chunk.is_empty() ? 1u : 0u);
+    });
+
+    voxel::Chunk fill_chunk({0, 0, 0});
+    fill_chunk.allocate();
+    run_bench("chunk/fill+promote", 2000, [&](std::size_t i) {
+        fill_chunk.fill(voxel::Voxel((i & 1u) ? voxel::VoxelType::STONE
+                                              : voxel::VoxelType::DIRT));
+        g_sink = g_sink + (fill_chunk.data()[0].type_id());  // Forces the dense splat
+    });
+}
+
+void bench_world_access() {
+    voxel::server::WorldConfig config;
+    config.seed = BENCH_SEED;
+    config.generator_type = "superflat";
+    voxel::server::World world(config);
+
+    // Pre-load a 4x1x4 chunk area so reads never hit the load path
+    for (voxel::ChunkCoord cx = 0; cx < 4; ++cx) {
+        for (voxel::ChunkCoord cz = 0; cz < 4; ++cz) {
+            (void)world.load_chunk({cx, 0, cz});
+        }
+    }
+
+    // Single-threaded baseline
+    std::mt19937_64 rng(BENCH_SEED);
+    std::uniform_int_distribution<voxel::ChunkCoord> dist(0, 255);
+    run_bench("world/get_voxel/1-thread", 2'000'000, [&](std::size_t) {
+        g_sink = g_sink + (world.get_voxel(dist(rng), dist(rng) & 63, dist(rng)).type_id());
+    });
+
+    // Concurrent readers: aggregate throughput across 4 threads
+    constexpr std::size_t READERS = 4;
+    constexpr std::size_t READS_PER_THREAD = 2'000'000;
+
+    const auto start = BenchClock::now();
+    std::vector<std::thread> threads;
+    threads.reserve(READERS);
+    for (std::size_t t = 0; t < READERS; ++t) {
+        threads.emplace_back([&world, t]() {
+            std::mt19937_64 thread_rng(BENCH_SEED + t);
+            std::uniform_int_distribution<voxel::ChunkCoord> coords(0, 255);
+            std::uint64_t local = 0;
+            for (std::size_t i = 0; i < READS_PER_THREAD; ++i) {
+                local += world.get_voxel(coords(thread_rng),
+                                         coords(thread_rng) & 63,
+                                         coords(thread_rng)).type_id();
+            }
+            g_sink = g_sink + (local);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    const auto end = BenchClock::now();
+
+    const double total_ns = std::chrono::duration<double, std::nano>(end - start).count();
+    const double ns_per_op = total_ns / static_cast<double>(READERS * READS_PER_THREAD);
+    std::printf("%-36s %10zu iters %12.1f ns/op %12.0f op/s (4 threads)\n",
+                "world/get_voxel/4-threads", READERS * READS_PER_THREAD,
+                ns_per_op, 1e9 / ns_per_op * READERS);
+}
+
+void bench_raycast() {
+    voxel::server::WorldConfig config;
+    config.seed = BENCH_SEED;
+    config.generator_type = "superflat";
+    voxel::server::World world(config);
+    for (voxel::ChunkCoord cx = 0; cx < 2; ++cx) {
+        for (voxel::ChunkCoord cz = 0; cz < 2; ++cz) {
+            (void)world.load_chunk({cx, 0, cz});
+        }
+    }
+
+    std::mt19937_64 rng(BENCH_SEED);
+    std::uniform_real_distribution<float> dir(-1.0f, 1.0f);
+
+    run_bench("raycast/cast/64-blocks", 200'000, [&](std::size_t) {
+        const voxel::RaycastHit hit = voxel::VoxelRaycaster::cast(
+            32.0, 40.0, 32.0,
+            dir(rng), -0.5f, dir(rng),
+            64.0f,
+            [&world](std::int64_t x, std::int64_t y, std::int64_t z) {
+                return world.get_voxel(static_cast<voxel::ChunkCoord>(x),
+                                       static_cast<voxel::ChunkCoord>(y),
+                                       static_cast<voxel::ChunkCoord>(z));
+            });
+        g_sink = g_sink + (hit.hit ? 1u : 0u);
+    });
+}
+
+void bench_mesh_queue() {
+    voxel::server::WorldConfig config;
+    config.seed = BENCH_SEED;
+    config.generator_type = "superflat";
+    voxel::server::World world(config);
+
+    constexpr voxel::ChunkCoord GRID = 4;
+    std::vector<voxel::ChunkPosition> positions;
+    for (voxel::ChunkCoord cx = 0; cx < GRID; ++cx) {
+        for (voxel::ChunkCoord cz = 0; cz < GRID; ++cz) {
+            positions.push_back({cx, 0, cz});
+            (void)world.load_chunk({cx, 0, cz});
+        }
+    }
+
+    voxel::client::MeshTaskQueue queue;
+    constexpr std::size_t ROUNDS = 20;
+
+    const auto start = BenchClock::now();
+    for (std::size_t round = 0; round < ROUNDS; ++round) {
+        for (const voxel::ChunkPosition& pos : positions) {
+            queue.queue_remesh(world.copy_padded_snapshot(pos));
+        }
+        queue.wait_idle();
+        for (const auto& result : queue.get_completed(positions.size())) {
+            g_sink = g_sink + (result.mesh.quad_count);
+        }
+    }
+    const auto end = BenchClock::now();
+
+    const std::size_t chunks = ROUNDS * positions.size();
+    const double total_s = std::chrono::duration<double>(end - start).count();
+    std::printf("%-36s %10zu chunks %11.1f us/chunk %10.0f chunk/s\n",
+                "mesh_queue/end-to-end", chunks,
+                total_s / static_cast<double>(chunks) * 1e6,
+                static_cast<double>(chunks) / total_s);
+}
+
+} // namespace
+
+int main() {
+    std::printf("voxel_bench (seed=%llu)\n",
+                static_cast<unsigned long long>(BENCH_SEED));
+    std::printf("------------------------------------------------------------------------------\n");
+
+    bench_mesh_generator();
+    bench_chunk_scans();
+    bench_world_access();
+    bench_raycast();
+    bench_mesh_queue();
+
+    std::printf("------------------------------------------------------------------------------\n");
+    std::printf("sink=%llu\n", static_cast<unsigned long long>(g_sink));
+    return 0;
+}
@@ -89,6 +89,7 @@ typedef void (APIENTRY *GLDEBUGPROC)(GLenum source, GLenum type, GLuint id, GLen
 #define GL_UNIFORM_BUFFER 0x8A11
 #define GL_SHADER_STORAGE_BUFFER 0x90D2
 #define GL_DRAW_INDIRECT_BUFFER 0x8F3F
+#define GL_PIXEL_UNPACK_BUFFER 0x88EC
 
 // Buffer usage
 #define GL_STREAM_DRAW 0x88E0
@@ -233,6 +234,40 @@ typedef void (APIENTRY *GLDEBUGPROC)(GLenum source, GLenum type, GLuint id, GLen
 #define GL_DEBUG_OUTPUT 0x92E0
 #define GL_DEBUG_OUTPUT_SYNCHRONOUS 0x8242
 
+// Program binaries
+#define GL_PROGRAM_BINARY_RETRIEVABLE_HINT 0x8257
+#define GL_PROGRAM_BINARY_LENGTH 0x8741
+#define GL_NUM_PROGRAM_BINARY_FORMATS 0x87FE
+
+// Queries
+#define GL_TIME_ELAPSED 0x88BF
+#define GL_TIMESTAMP 0x8E28
+#define GL_QUERY_RESULT 0x8866
+#define GL_QUERY_RESULT_AVAILABLE 0x8867
+
+// Copy / viewport
+#define GL_COPY_READ_BUFFER 0x8F36
+#define GL_COPY_WRITE_BUFFER 0x8F37
+#define GL_VIEWPORT 0x0BA2
+
+// Depth formats / compare
+#define GL_DEPTH_COMPONENT 0x1902
+#define GL_DEPTH_COMPONENT24 0x81A6
+#define GL_TEXTURE_COMPARE_MODE 0x884C
+
+// Image load/store
+#define GL_R32F 0x822E
+#define GL_READ_ONLY 0x88B8
+#define GL_WRITE_ONLY 0x88B9
+#define GL_READ_WRITE 0x88BA
+
+// Memory barriers
+#define GL_SHADER_IMAGE_ACCESS_BARRIER_BIT 0x00000020
+#define GL_COMMAND_BARRIER_BIT 0x00000040
+#define GL_TEXTURE_FETCH_BARRIER_BIT 0x00000008
+#define GL_SHADER_STORAGE_BARRIER_BIT 0x00002000
+#define GL_ALL_BARRIER_BITS 0xFFFFFFFF
+
 // Function pointer types
 typedef void (APIENTRY *PFNGLCLEARPROC)(GLbitfield mask);
 typedef void (APIENTRY *PFNGLCLEARCOLORPROC)(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha);
@@ -240,6 +275,7 @@ typedef void (APIENTRY *PFNGLVIEWPORTPROC)(GLint x, GLint y, GLsizei width, GLsi
 typedef void (APIENTRY *PFNGLENABLEPROC)(GLenum cap);
 typedef void (APIENTRY *PFNGLDISABLEPROC)(GLenum cap);
 typedef void (APIENTRY *PFNGLDEPTHFUNCPROC)(GLenum func);
+typedef void (APIENTRY *PFNGLDEPTHMASKPROC)(GLboolean flag);
 typedef void (APIENTRY *PFNGLCULLFACEPROC)(GLenum mode);
 typedef void (APIENTRY *PFNGLFRONTFACEPROC)(GLenum mode);
 typedef void (APIENTRY *PFNGLPOLYGONMODEPROC)(GLenum face, GLenum mode);
@@ -284,6 +320,9 @@ typedef void (APIENTRY *PFNGLLINKPROGRAMPROC)(GLuint program);
 typedef void (APIENTRY *PFNGLUSEPROGRAMPROC)(GLuint program);
 typedef void (APIENTRY *PFNGLGETPROGRAMIVPROC)(GLuint program, GLenum pname, GLint* params);
 typedef void (APIENTRY *PFNGLGETPROGRAMINFOLOGPROC)(GLuint program, GLsizei bufSize, GLsizei* length, GLchar* infoLog);
+typedef void (APIENTRY *PFNGLGETPROGRAMBINARYPROC)(GLuint program, GLsizei bufSize, GLsizei* length, GLenum* binaryFormat, void* binary);
+typedef void (APIENTRY *PFNGLPROGRAMBINARYPROC)(GLuint program, GLenum binaryFormat, const void* binary, GLsizei length);
+typedef void (APIENTRY *PFNGLPROGRAMPARAMETERIPROC)(GLuint program, GLenum pname, GLint value);
 
 // Uniforms
 typedef GLint (APIENTRY *PFNGLGETUNIFORMLOCATIONPROC)(GLuint program, const GLchar* name);
@@ -300,6 +339,29 @@ typedef void (APIENTRY *PFNGLUNIFORMMATRIX4FVPROC)(GLint location, GLsizei count
 typedef void (APIENTRY *PFNGLDRAWARRAYSPROC)(GLenum mode, GLint first, GLsizei count);
 typedef void (APIENTRY *PFNGLDRAWELEMENTSPROC)(GLenum mode, GLsizei count, GLenum type, const void* indices);
 typedef void (APIENTRY *PFNGLMULTIDRAWELEMENTSINDIRECTPROC)(GLenum mode, GLenum type, const void* indirect, GLsizei drawcount, GLsizei stride);
+typedef void (APIENTRY *PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC)(GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instancecount, GLint basevertex, GLuint baseinstance);
+
+// Buffer copies / binding points
+typedef void (APIENTRY *PFNGLCOPYNAMEDBUFFERSUBDATAPROC)(GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size);
+typedef void (APIENTRY *PFNGLBINDBUFFERBASEPROC)(GLenum target, GLuint index, GLuint buffer);
+typedef void (APIENTRY *PFNGLVERTEXARRAYBINDINGDIVISORPROC)(GLuint vaobj, GLuint bindingindex, GLuint divisor);
+
+// Compute / image load-store
+typedef void (APIENTRY *PFNGLDISPATCHCOMPUTEPROC)(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z);
+typedef void (APIENTRY *PFNGLMEMORYBARRIERPROC)(GLbitfield barriers);
+typedef void (APIENTRY *PFNGLBINDIMAGETEXTUREPROC)(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format);
+
+// Framebuffer / depth copy
+typedef void (APIENTRY *PFNGLBINDFRAMEBUFFERPROC)(GLenum target, GLuint framebuffer);
+typedef void (APIENTRY *PFNGLCOPYTEXTURESUBIMAGE2DPROC)(GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height);
+
+// Queries
+typedef void (APIENTRY *PFNGLCREATEQUERIESPROC)(GLenum target, GLsizei n, GLuint* ids);
+typedef void (APIENTRY *PFNGLDELETEQUERIESPROC)(GLsizei n, const GLuint* ids);
+typedef void (APIENTRY *PFNGLBEGINQUERYPROC)(GLenum target, GLuint id);
+typedef void (APIENTRY *PFNGLENDQUERYPROC)(GLenum target);
+typedef void (APIENTRY *PFNGLGETQUERYOBJECTIVPROC)(GLuint id, GLenum pname, GLint* params);
+typedef void (APIENTRY *PFNGLGETQUERYOBJECTUI64VPROC)(GLuint id, GLenum pname, GLuint64* params);
 
 // Sync
 typedef GLsync (APIENTRY *PFNGLFENCESYNCPROC)(GLenum condition, GLbitfield flags);
@@ -336,6 +398,7 @@ extern PFNGLVIEWPORTPROC glViewport;
 extern PFNGLENABLEPROC glEnable;
 extern PFNGLDISABLEPROC glDisable;
 extern PFNGLDEPTHFUNCPROC glDepthFunc;
+extern PFNGLDEPTHMASKPROC glDepthMask;
 extern PFNGLCULLFACEPROC glCullFace;
 extern PFNGLFRONTFACEPROC glFrontFace;
 extern PFNGLPOLYGONMODEPROC glPolygonMode;
@@ -378,6 +441,9 @@ extern PFNGLLINKPROGRAMPROC glLinkProgram;
 extern PFNGLUSEPROGRAMPROC glUseProgram;
 extern PFNGLGETPROGRAMIVPROC glGetProgramiv;
 extern PFNGLGETPROGRAMINFOLOGPROC glGetProgramInfoLog;
+extern PFNGLGETPROGRAMBINARYPROC glGetProgramBinary;
+extern PFNGLPROGRAMBINARYPROC glProgramBinary;
+extern PFNGLPROGRAMPARAMETERIPROC glProgramParameteri;
 
 extern PFNGLGETUNIFORMLOCATIONPROC glGetUniformLocation;
 extern PFNGLUNIFORM1IPROC glUniform1i;
@@ -392,6 +458,25 @@ extern PFNGLUNIFORMMATRIX4FVPROC glUniformMatrix4fv;
 extern PFNGLDRAWARRAYSPROC glDrawArrays;
 extern PFNGLDRAWELEMENTSPROC glDrawElements;
 extern PFNGLMULTIDRAWELEMENTSINDIRECTPROC glMultiDrawElementsIndirect;
+extern PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC glDrawElementsInstancedBaseVertexBaseInstance;
+
+extern PFNGLCOPYNAMEDBUFFERSUBDATAPROC glCopyNamedBufferSubData;
+extern PFNGLBINDBUFFERBASEPROC glBindBufferBase;
+extern PFNGLVERTEXARRAYBINDINGDIVISORPROC glVertexArrayBindingDivisor;
+
+extern PFNGLDISPATCHCOMPUTEPROC glDispatchCompute;
+extern PFNGLMEMORYBARRIERPROC glMemoryBarrier;
+extern PFNGLBINDIMAGETEXTUREPROC glBindImageTexture;
+
+extern PFNGLBINDFRAMEBUFFERPROC glBindFramebuffer;
+extern PFNGLCOPYTEXTURESUBIMAGE2DPROC glCopyTextureSubImage2D;
+
+extern PFNGLCREATEQUERIESPROC glCreateQueries;
+extern PFNGLDELETEQUERIESPROC glDeleteQueries;
+extern PFNGLBEGINQUERYPROC glBeginQuery;
+extern PFNGLENDQUERYPROC glEndQuery;
+extern PFNGLGETQUERYOBJECTIVPROC glGetQueryObjectiv;
+extern PFNGLGETQUERYOBJECTUI64VPROC glGetQueryObjectui64v;
 
 extern PFNGLFENCESYNCPROC glFenceSync;
 extern PFNGLDELETESYNCPROC glDeleteSync;
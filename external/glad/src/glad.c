@@ -11,6 +11,7 @@ PFNGLVIEWPORTPROC glViewport = 0;
 PFNGLENABLEPROC glEnable = 0;
 PFNGLDISABLEPROC glDisable = 0;
 PFNGLDEPTHFUNCPROC glDepthFunc = 0;
+PFNGLDEPTHMASKPROC glDepthMask = 0;
 PFNGLCULLFACEPROC glCullFace = 0;
 PFNGLFRONTFACEPROC glFrontFace = 0;
 PFNGLPOLYGONMODEPROC glPolygonMode = 0;
@@ -53,6 +54,9 @@ PFNGLLINKPROGRAMPROC glLinkProgram = 0;
 PFNGLUSEPROGRAMPROC glUseProgram = 0;
 PFNGLGETPROGRAMIVPROC glGetProgramiv = 0;
 PFNGLGETPROGRAMINFOLOGPROC glGetProgramInfoLog = 0;
+PFNGLGETPROGRAMBINARYPROC glGetProgramBinary = 0;
+PFNGLPROGRAMBINARYPROC glProgramBinary = 0;
+PFNGLPROGRAMPARAMETERIPROC glProgramParameteri = 0;
 
 PFNGLGETUNIFORMLOCATIONPROC glGetUniformLocation = 0;
 PFNGLUNIFORM1IPROC glUniform1i = 0;
@@ -67,6 +71,25 @@ PFNGLUNIFORMMATRIX4FVPROC glUniformMatrix4fv = 0;
 PFNGLDRAWARRAYSPROC glDrawArrays = 0;
 PFNGLDRAWELEMENTSPROC glDrawElements = 0;
 PFNGLMULTIDRAWELEMENTSINDIRECTPROC glMultiDrawElementsIndirect = 0;
+PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC glDrawElementsInstancedBaseVertexBaseInstance = 0;
+
+PFNGLCOPYNAMEDBUFFERSUBDATAPROC glCopyNamedBufferSubData = 0;
+PFNGLBINDBUFFERBASEPROC glBindBufferBase = 0;
+PFNGLVERTEXARRAYBINDINGDIVISORPROC glVertexArrayBindingDivisor = 0;
+
+PFNGLDISPATCHCOMPUTEPROC glDispatchCompute = 0;
+PFNGLMEMORYBARRIERPROC glMemoryBarrier = 0;
+PFNGLBINDIMAGETEXTUREPROC glBindImageTexture = 0;
+
+PFNGLBINDFRAMEBUFFERPROC glBindFramebuffer = 0;
+PFNGLCOPYTEXTURESUBIMAGE2DPROC glCopyTextureSubImage2D = 0;
+
+PFNGLCREATEQUERIESPROC glCreateQueries = 0;
+PFNGLDELETEQUERIESPROC glDeleteQueries = 0;
+PFNGLBEGINQUERYPROC glBeginQuery = 0;
+PFNGLENDQUERYPROC glEndQuery = 0;
+PFNGLGETQUERYOBJECTIVPROC glGetQueryObjectiv = 0;
+PFNGLGETQUERYOBJECTUI64VPROC glGetQueryObjectui64v = 0;
 
 PFNGLFENCESYNCPROC glFenceSync = 0;
 PFNGLDELETESYNCPROC glDeleteSync = 0;
@@ -100,6 +123,7 @@ int gladLoadGLLoader(GLADloadproc load) {
     glEnable = (PFNGLENABLEPROC)get_proc(load, "glEnable");
     glDisable = (PFNGLDISABLEPROC)get_proc(load, "glDisable");
     glDepthFunc = (PFNGLDEPTHFUNCPROC)get_proc(load, "glDepthFunc");
+    glDepthMask = (PFNGLDEPTHMASKPROC)get_proc(load, "glDepthMask");
     glCullFace = (PFNGLCULLFACEPROC)get_proc(load, "glCullFace");
     glFrontFace = (PFNGLFRONTFACEPROC)get_proc(load, "glFrontFace");
     glPolygonMode = (PFNGLPOLYGONMODEPROC)get_proc(load, "glPolygonMode");
@@ -142,6 +166,9 @@ int gladLoadGLLoader(GLADloadproc load) {
     glUseProgram = (PFNGLUSEPROGRAMPROC)get_proc(load, "glUseProgram");
     glGetProgramiv = (PFNGLGETPROGRAMIVPROC)get_proc(load, "glGetProgramiv");
     glGetProgramInfoLog = (PFNGLGETPROGRAMINFOLOGPROC)get_proc(load, "glGetProgramInfoLog");
+    glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)get_proc(load, "glGetProgramBinary");
+    glProgramBinary = (PFNGLPROGRAMBINARYPROC)get_proc(load, "glProgramBinary");
+    glProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC)get_proc(load, "glProgramParameteri");
 
     glGetUniformLocation = (PFNGLGETUNIFORMLOCATIONPROC)get_proc(load, "glGetUniformLocation");
     glUniform1i = (PFNGLUNIFORM1IPROC)get_proc(load, "glUniform1i");
@@ -156,6 +183,25 @@ int gladLoadGLLoader(GLADloadproc load) {
     glDrawArrays = (PFNGLDRAWARRAYSPROC)get_proc(load, "glDrawArrays");
     glDrawElements = (PFNGLDRAWELEMENTSPROC)get_proc(load, "glDrawElements");
     glMultiDrawElementsIndirect = (PFNGLMULTIDRAWELEMENTSINDIRECTPROC)get_proc(load, "glMultiDrawElementsIndirect");
+    glDrawElementsInstancedBaseVertexBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC)get_proc(load, "glDrawElementsInstancedBaseVertexBaseInstance");
+
+    glCopyNamedBufferSubData = (PFNGLCOPYNAMEDBUFFERSUBDATAPROC)get_proc(load, "glCopyNamedBufferSubData");
+    glBindBufferBase = (PFNGLBINDBUFFERBASEPROC)get_proc(load, "glBindBufferBase");
+    glVertexArrayBindingDivisor = (PFNGLVERTEXARRAYBINDINGDIVISORPROC)get_proc(load, "glVertexArrayBindingDivisor");
+
+    glDispatchCompute = (PFNGLDISPATCHCOMPUTEPROC)get_proc(load, "glDispatchCompute");
+    glMemoryBarrier = (PFNGLMEMORYBARRIERPROC)get_proc(load, "glMemoryBarrier");
+    glBindImageTexture = (PFNGLBINDIMAGETEXTUREPROC)get_proc(load, "glBindImageTexture");
+
+    glBindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC)get_proc(load, "glBindFramebuffer");
+    glCopyTextureSubImage2D = (PFNGLCOPYTEXTURESUBIMAGE2DPROC)get_proc(load, "glCopyTextureSubImage2D");
+
+    glCreateQueries = (PFNGLCREATEQUERIESPROC)get_proc(load, "glCreateQueries");
+    glDeleteQueries = (PFNGLDELETEQUERIESPROC)get_proc(load, "glDeleteQueries");
+    glBeginQuery = (PFNGLBEGINQUERYPROC)get_proc(load, "glBeginQuery");
+    glEndQuery = (PFNGLENDQUERYPROC)get_proc(load, "glEndQuery");
+    glGetQueryObjectiv = (PFNGLGETQUERYOBJECTIVPROC)get_proc(load, "glGetQueryObjectiv");
+    glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)get_proc(load, "glGetQueryObjectui64v");
 
     glFenceSync = (PFNGLFENCESYNCPROC)get_proc(load, "glFenceSync");
     glDeleteSync = (PFNGLDELETESYNCPROC)get_proc(load, "glDeleteSync");
@@ -202,6 +202,88 @@ struct WorldPosition {
     }
 };
 
+// =============================================================================
+// VIEW FRUSTUM
+// Six planes extracted from a view-projection matrix (Gribb/Hartmann),
+// with a p/n-vertex AABB test for chunk culling. Coordinates are in the
+// same camera-relative space the renderer draws in.
+// =============================================================================
+struct Frustum {
+    enum class Containment : std::uint8_t {
+        OUTSIDE,     // AABB fully behind at least one plane
+        INTERSECTS,  // AABB straddles the frustum boundary
+        INSIDE       // AABB fully inside all six planes
+    };
+
+    // Plane as ax + by + cz + d = 0, normal pointing into the frustum
+    struct Plane {
+        float x, y, z, d;
+    };
+
+    std::array<Plane, 6> planes;
+
+    // Extract and normalize planes from a column-major view-projection
+    void extract(const math::Mat4& view_projection) noexcept {
+        const auto row = [&view_projection](int r) {
+            return Plane{
+                view_projection(r, 0),
+                view_projection(r, 1),
+                view_projection(r, 2),
+                view_projection(r, 3)
+            };
+        };
+        const Plane r0 = row(0);
+        const Plane r1 = row(1);
+        const Plane r2 = row(2);
+        const Plane r3 = row(3);
+
+        planes[0] = Plane{r3.x + r0.x, r3.y + r0.y, r3.z + r0.z, r3.d + r0.d};  // Left
+        planes[1] = Plane{r3.x - r0.x, r3.y - r0.y, r3.z - r0.z, r3.d - r0.d};  // Right
+        planes[2] = Plane{r3.x + r1.x, r3.y + r1.y, r3.z + r1.z, r3.d + r1.d};  // Bottom
+        planes[3] = Plane{r3.x - r1.x, r3.y - r1.y, r3.z - r1.z, r3.d - r1.d};  // Top
+        planes[4] = Plane{r3.x + r2.x, r3.y + r2.y, r3.z + r2.z, r3.d + r2.d};  // Near
+        planes[5] = Plane{r3.x - r2.x, r3.y - r2.y, r3.z - r2.z, r3.d - r2.d};  // Far
+
+        for (Plane& plane : planes) {
+            const float len = std::sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+            if (len > 0.0001f) {
+                plane.x /= len;
+                plane.y /= len;
+                plane.z /= len;
+                plane.d /= len;
+            }
+        }
+    }
+
+    // Classify an AABB against all six planes using the p-vertex
+    // (farthest along the normal) and n-vertex (nearest)
+    [[nodiscard]] Containment classify_aabb(const math::Vec3& min, const math::Vec3& max) const noexcept {
+        Containment result = Containment::INSIDE;
+
+        for (const Plane& plane : planes) {
+            const float px = plane.x >= 0.0f ? max.x : min.x;
+            const float py = plane.y >= 0.0f ? max.y : min.y;
+            const float pz = plane.z >= 0.0f ? max.z : min.z;
+            if (plane.x * px + plane.y * py + plane.z * pz + plane.d < 0.0f) {
+                return Containment::OUTSIDE;
+            }
+
+            const float nx = plane.x >= 0.0f ? min.x : max.x;
+            const float ny = plane.y >= 0.0f ? min.y : max.y;
+            const float nz = plane.z >= 0.0f ? min.z : max.z;
+            if (plane.x * nx + plane.y * ny + plane.z * nz + plane.d < 0.0f) {
+                result = Containment::INTERSECTS;
+            }
+        }
+
+        return result;
+    }
+
+    [[nodiscard]] bool intersects_aabb(const math::Vec3& min, const math::Vec3& max) const noexcept {
+        return classify_aabb(min, max) != Containment::OUTSIDE;
+    }
+};
+
 // =============================================================================
 // CAMERA
 // First-person camera with origin shifting for precision at world boundaries
@@ -14,21 +14,42 @@ namespace voxel::client {
 
 // =============================================================================
 // CHUNK MESH
-// Contains vertex and index data for a single chunk
+// Contains vertex and index data for a single chunk, split into an
+// opaque stream (drawn depth-tested front-to-back) and a translucent
+// stream (water, glass - drawn blended back-to-front after all opaque
+// geometry)
 // =============================================================================
 struct ChunkMesh {
-    // Vertex data (packed 8-byte vertices)
+    // Opaque vertex data (packed 8-byte vertices)
     std::vector<PackedVertex> vertices;
 
-    // Index data (32-bit indices for large meshes)
+    // Opaque index data (32-bit indices for large meshes)
     std::vector<std::uint32_t> indices;
 
+    // Translucent sub-mesh (empty for most chunks)
+    std::vector<PackedVertex> translucent_vertices;
+    std::vector<std::uint32_t> translucent_indices;
+
     // Chunk world position (for origin-relative rendering)
     ChunkPosition position;
 
-    // Mesh statistics
+    // Mesh statistics (opaque stream; the translucent stream is counted
+    // separately since it takes a different draw path)
     std::uint32_t quad_count = 0;     // Number of quads (faces)
     std::uint32_t triangle_count = 0; // Number of triangles (quad_count * 2)
+    std::uint32_t translucent_quad_count = 0;
+
+    // Level of detail this mesh was built at
+    // (0 = full resolution, n = voxels downsampled 2^n per axis)
+    std::uint8_t lod = 0;
+
+    // Per-(face, slice) quad counts in append order (face * 64 + slice),
+    // filled by full-resolution greedy meshing. Quads are appended in
+    // bucket order, so these counts let an incremental remesh splice
+    // rebuilt slices into the rest of the mesh. Empty = no bucket info
+    // (LOD meshes, cleared meshes). Opaque stream only - the translucent
+    // stream is small enough to rebuild whole.
+    std::vector<std::uint16_t> slice_quads;
 
     // GPU buffer handles (set by renderer)
     std::uint32_t vao = 0;
@@ -53,8 +74,12 @@ struct ChunkMesh {
     void clear() noexcept {
         vertices.clear();
         indices.clear();
+        translucent_vertices.clear();
+        translucent_indices.clear();
+        slice_quads.clear();
         quad_count = 0;
         triangle_count = 0;
+        translucent_quad_count = 0;
         is_empty = true;
         needs_update = true;
     }
@@ -92,10 +117,31 @@ struct ChunkMesh {
         is_empty = false;
     }
 
+    // Add a quad to the translucent sub-mesh
+    void add_translucent_quad(const PackedVertex& v0, const PackedVertex& v1,
+                              const PackedVertex& v2, const PackedVertex& v3) {
+        const auto base_index = static_cast<std::uint32_t>(translucent_vertices.size());
+
+        translucent_vertices.push_back(v0);
+        translucent_vertices.push_back(v1);
+        translucent_vertices.push_back(v2);
+        translucent_vertices.push_back(v3);
+
+        translucent_indices.push_back(base_index + 0);
+        translucent_indices.push_back(base_index + 1);
+        translucent_indices.push_back(base_index + 2);
+        translucent_indices.push_back(base_index + 2);
+        translucent_indices.push_back(base_index + 3);
+        translucent_indices.push_back(base_index + 0);
+
+        ++translucent_quad_count;
+        is_empty = false;
+    }
+
     // Memory usage in bytes
     [[nodiscard]] std::size_t memory_usage() const noexcept {
-        return vertices.size() * sizeof(PackedVertex) +
-               indices.size() * sizeof(std::uint32_t);
+        return (vertices.size() + translucent_vertices.size()) * sizeof(PackedVertex) +
+               (indices.size() + translucent_indices.size()) * sizeof(std::uint32_t);
     }
 };
 
@@ -0,0 +1,241 @@
+// =============================================================================
+// VOXEL ENGINE - CHUNK STREAMER
+// Distance-prioritized chunk loading around the camera. Each frame the
+// wanted set is rebuilt from the camera chunk, sorted nearest-first with
+// in-frustum chunks ahead of off-screen ones, and a bounded number of
+// async load requests is issued. Because the queue is rebuilt per frame,
+// positions that fall out of range are cancelled for free before they
+// are ever handed to the world. Chunks beyond the unload radius are
+// evicted with hysteresis so walking along a boundary does not thrash.
+// =============================================================================
+#pragma once
+
+#include "Shared/Types.hpp"
+#include "Client/Camera.hpp"
+#include "Server/World.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+namespace voxel::client {
+
+// =============================================================================
+// CHUNK STREAMER
+// =============================================================================
+class ChunkStreamer {
+public:
+    struct Config {
+        ChunkCoord load_radius = 4;        // Horizontal radius of wanted chunks
+        ChunkCoord unload_radius = 6;      // Evict beyond this (> load_radius)
+        ChunkCoord y_min = 0;              // Vertical slab of wanted chunks
+        ChunkCoord y_max = 0;
+        std::uint32_t requests_per_frame = 4;   // New async loads issued per frame
+        std::uint32_t max_in_flight = 16;       // Cap on outstanding loads
+    };
+
+    // Fired on the main thread from update() once a loaded chunk is
+    // resident (mesh generation, fluid init); and just before a chunk
+    // beyond the unload radius is removed (mesh teardown)
+    using LoadedCallback = std::function<void(ChunkPosition)>;
+    using UnloadCallback = std::function<void(ChunkPosition)>;
+
+    ChunkStreamer(server::World& world, Config config)
+        : m_world(world)
+        , m_config(config) {}
+
+    ChunkStreamer(const ChunkStreamer&) = delete;
+    ChunkStreamer& operator=(const ChunkStreamer&) = delete;
+
+    void set_on_loaded(LoadedCallback callback) { m_on_loaded = std::move(callback); }
+    void set_on_unload(UnloadCallback callback) { m_on_unload = std::move(callback); }
+
+    // Seed the in-flight bookkeeping for chunks loaded outside the
+    // streamer (the startup batch), so they are not re-requested
+    void mark_resident(const std::vector<ChunkPosition>& positions) {
+        for (const ChunkPosition& pos : positions) {
+            m_resident.insert(pos);
+        }
+    }
+
+    // Drop positions unloaded outside the streamer (World::evict_lru),
+    // so they are re-requested if the player comes back
+    void forget(const std::vector<ChunkPosition>& positions) {
+        for (const ChunkPosition& pos : positions) {
+            m_resident.erase(pos);
+        }
+    }
+
+    // Per-frame driver: drain completed loads, rebuild and issue the
+    // wanted queue, evict far chunks
+    void update(const Camera& camera) {
+        drain_completed();
+
+        const ChunkPosition center = camera_chunk(camera);
+        Frustum frustum;
+        frustum.extract(camera.view_projection_matrix());
+
+        issue_loads(center, frustum, camera.render_origin());
+        unload_far_chunks(center);
+    }
+
+    [[nodiscard]] std::uint32_t in_flight() const noexcept { return m_in_flight; }
+    [[nodiscard]] std::size_t resident_count() const noexcept { return m_resident.size(); }
+
+private:
+    struct Candidate {
+        ChunkPosition pos;
+        std::int64_t priority;  // Lower loads first
+    };
+
+    struct Completion {
+        ChunkPosition pos;
+        bool loaded;  // false: request failed, slot comes back anyway
+    };
+
+    [[nodiscard]] static ChunkPosition camera_chunk(const Camera& camera) noexcept {
+        const WorldPosition& pos = camera.position();
+        return ChunkPosition{
+            static_cast<ChunkCoord>(static_cast<std::int64_t>(std::floor(pos.x)) >> 6),
+            static_cast<ChunkCoord>(static_cast<std::int64_t>(std::floor(pos.y)) >> 6),
+            static_cast<ChunkCoord>(static_cast<std::int64_t>(std::floor(pos.z)) >> 6)};
+    }
+
+    void drain_completed() {
+        std::vector<Completion> completed;
+        {
+            std::lock_guard<std::mutex> lock(m_completed_mutex);
+            completed.swap(m_completed);
+        }
+        for (const Completion& done : completed) {
+            if (m_in_flight > 0) {
+                --m_in_flight;
+            }
+            // Failed loads (out of bounds, dropped duplicate) only give
+            // the slot back; the position stays requestable
+            if (!done.loaded) {
+                continue;
+            }
+            m_resident.insert(done.pos);
+            if (m_on_loaded) {
+                m_on_loaded(done.pos);
+            }
+        }
+    }
+
+    void issue_loads(ChunkPosition center, const Frustum& frustum,
+                     const WorldPosition& render_origin) {
+        if (m_in_flight >= m_config.max_in_flight) {
+            return;
+        }
+
+        // Rebuild the wanted list from scratch: anything that left the
+        // radius since last frame simply never reappears (cancelled
+        // before it was issued)
+        m_candidates.clear();
+        const ChunkCoord r = m_config.load_radius;
+        for (ChunkCoord cy = m_config.y_min; cy <= m_config.y_max; ++cy) {
+            for (ChunkCoord cx = center.x - r; cx <= center.x + r; ++cx) {
+                for (ChunkCoord cz = center.z - r; cz <= center.z + r; ++cz) {
+                    const ChunkPosition pos{cx, cy, cz};
+                    if (m_resident.count(pos) != 0 || m_world.is_load_pending(pos)) {
+                        continue;
+                    }
+                    if (m_world.has_chunk(pos)) {
+                        m_resident.insert(pos);
+                        continue;
+                    }
+
+                    const std::int64_t dx = cx - center.x;
+                    const std::int64_t dz = cz - center.z;
+                    std::int64_t priority = dx * dx + dz * dz;
+
+                    // Off-screen chunks sort behind everything visible
+                    const math::Vec3 aabb_min{
+                        static_cast<float>(static_cast<double>(cx) * CHUNK_SIZE_X - render_origin.x),
+                        static_cast<float>(static_cast<double>(cy) * CHUNK_SIZE_Y - render_origin.y),
+                        static_cast<float>(static_cast<double>(cz) * CHUNK_SIZE_Z - render_origin.z)};
+                    const math::Vec3 aabb_max{
+                        aabb_min.x + static_cast<float>(CHUNK_SIZE_X),
+                        aabb_min.y + static_cast<float>(CHUNK_SIZE_Y),
+                        aabb_min.z + static_cast<float>(CHUNK_SIZE_Z)};
+                    if (frustum.classify_aabb(aabb_min, aabb_max) == Frustum::Containment::OUTSIDE) {
+                        priority += OFF_SCREEN_PENALTY;
+                    }
+
+                    m_candidates.push_back(Candidate{pos, priority});
+                }
+            }
+        }
+
+        if (m_candidates.empty()) {
+            return;
+        }
+
+        // Only the handful we can issue this frame needs to be ordered
+        const std::size_t budget = std::min<std::size_t>(
+            std::min<std::size_t>(m_config.requests_per_frame,
+                                  m_config.max_in_flight - m_in_flight),
+            m_candidates.size());
+        std::partial_sort(
+            m_candidates.begin(), m_candidates.begin() + static_cast<std::ptrdiff_t>(budget),
+            m_candidates.end(),
+            [](const Candidate& a, const Candidate& b) { return a.priority < b.priority; });
+
+        for (std::size_t i = 0; i < budget; ++i) {
+            const ChunkPosition pos = m_candidates[i].pos;
+            ++m_in_flight;
+            m_world.load_chunk_async(pos, [this, pos](Chunk* chunk) {
+                // Worker thread: just record completion; all client-side
+                // work happens in the next update() on the main thread.
+                // Failures report too - load_chunk_async invokes the
+                // callback exactly once per request, and every issued
+                // request must hand its in-flight slot back
+                std::lock_guard<std::mutex> lock(m_completed_mutex);
+                m_completed.push_back(Completion{pos, chunk != nullptr});
+            });
+        }
+    }
+
+    void unload_far_chunks(ChunkPosition center) {
+        const ChunkCoord r = m_config.unload_radius;
+        m_to_unload.clear();
+        for (const ChunkPosition& pos : m_resident) {
+            if (std::abs(pos.x - center.x) > r || std::abs(pos.z - center.z) > r) {
+                m_to_unload.push_back(pos);
+            }
+        }
+        for (const ChunkPosition& pos : m_to_unload) {
+            if (m_on_unload) {
+                m_on_unload(pos);
+            }
+            m_world.unload_chunk(pos);
+            m_resident.erase(pos);
+        }
+    }
+
+    static constexpr std::int64_t OFF_SCREEN_PENALTY = 1 << 20;
+
+    server::World& m_world;
+    Config m_config;
+    LoadedCallback m_on_loaded;
+    UnloadCallback m_on_unload;
+
+    // Chunks this streamer considers loaded client-side
+    std::unordered_set<ChunkPosition> m_resident;
+    std::uint32_t m_in_flight = 0;
+
+    // Filled by worker-thread load callbacks, drained in update()
+    std::mutex m_completed_mutex;
+    std::vector<Completion> m_completed;
+
+    // Per-frame scratch (reused to avoid reallocation)
+    std::vector<Candidate> m_candidates;
+    std::vector<ChunkPosition> m_to_unload;
+};
+
+} // namespace voxel::client
@@ -38,6 +38,18 @@ struct DebugOverlayData {
     uint32_t chunk_count = 0;
     uint64_t total_vertices = 0;   // Total vertex count (greedy mesh verification)
     uint64_t total_triangles = 0;  // Total triangle count (indices / 3)
+    uint32_t draw_calls = 0;
+    uint32_t chunks_culled = 0;
+
+    // Per-pass GPU timings (copied from Renderer::gpu_pass_ms each frame;
+    // values lag the CPU by a few frames due to query buffering)
+    struct GpuPass {
+        char name[24] = "";
+        float gpu_ms = 0.0f;
+    };
+    static constexpr size_t MAX_GPU_PASSES = 8;
+    uint32_t gpu_pass_count = 0;
+    GpuPass gpu_passes[MAX_GPU_PASSES];
     
     // Physics & Player State
     float player_x = 0.0f;
@@ -51,6 +63,17 @@ struct DebugOverlayData {
     bool on_ground = false;
     bool collision_enabled = true;
     uint8_t selected_block = 1;
+
+    // Tick profiler zones (copied from TickProfiler::query each frame)
+    struct TickZone {
+        char name[24] = "";
+        float p50_ms = 0.0f;
+        float p95_ms = 0.0f;
+        float p99_ms = 0.0f;
+    };
+    static constexpr size_t MAX_TICK_ZONES = 16;
+    uint32_t tick_zone_count = 0;
+    TickZone tick_zones[MAX_TICK_ZONES];
 };
 
 class ImGuiDebugOverlay {
@@ -95,8 +118,34 @@ public:
             ImGui::TextColored(ImVec4(1.0f, 1.0f, 0.5f, 1.0f), "Geometry");
             ImGui::Text("Vertices: %llu", static_cast<unsigned long long>(data.total_vertices));
             ImGui::Text("Triangles: %llu", static_cast<unsigned long long>(data.total_triangles));
-            
+            ImGui::Text("Draw Calls: %u | Culled: %u", data.draw_calls, data.chunks_culled);
+
             ImGui::Separator();
+
+            // === GPU PASSES (timer queries) ===
+            if (data.gpu_pass_count > 0) {
+                ImGui::TextColored(ImVec4(1.0f, 1.0f, 0.5f, 1.0f), "GPU Passes (ms)");
+                for (uint32_t i = 0; i < data.gpu_pass_count && i < DebugOverlayData::MAX_GPU_PASSES; ++i) {
+                    const auto& pass = data.gpu_passes[i];
+                    ImGui::Text("%-14s %6.3f", pass.name, static_cast<double>(pass.gpu_ms));
+                }
+
+                ImGui::Separator();
+            }
+
+            // === TICK ZONES (per-system profiler) ===
+            if (data.tick_zone_count > 0) {
+                ImGui::TextColored(ImVec4(1.0f, 1.0f, 0.5f, 1.0f), "Tick Zones (p50/p95/p99 ms)");
+                for (uint32_t i = 0; i < data.tick_zone_count && i < DebugOverlayData::MAX_TICK_ZONES; ++i) {
+                    const auto& zone = data.tick_zones[i];
+                    ImGui::Text("%-12s %6.2f %6.2f %6.2f", zone.name,
+                               static_cast<double>(zone.p50_ms),
+                               static_cast<double>(zone.p95_ms),
+                               static_cast<double>(zone.p99_ms));
+                }
+
+                ImGui::Separator();
+            }
             
             // === PLAYER POSITION ===
             ImGui::TextColored(ImVec4(1.0f, 1.0f, 0.5f, 1.0f), "Player Position");
@@ -1,13 +1,27 @@
 // =============================================================================
-// VOXEL ENGINE - FILE LOGGER
+// VOXEL ENGINE - ASYNCHRONOUS FILE LOGGER
+// Lock-free MPSC front end + dedicated formatting/flushing thread.
+// The hot path encodes call-site arguments as tagged values into a
+// bounded ring slot (no formatting, no allocation, no locks); a
+// background thread decodes, formats and writes. Render and mesh-worker
+// threads never wait on the log file - a full ring drops the message
+// and counts it instead of blocking.
 // =============================================================================
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
 #include <fstream>
-#include <string>
 #include <sstream>
-#include <cstdint>
-#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
 
 namespace voxel {
 
@@ -19,85 +33,329 @@ public:
     }
 
     bool open(const std::string& filename) {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        if (m_file.is_open()) {
-            m_file.close();
-        }
+        close();
         m_file.open(filename, std::ios::out | std::ios::trunc);
-        if (m_file.is_open()) {
-            m_file << "=== VOXEL ENGINE LOG ===\n\n";
-            m_file.flush();
-            return true;
+        if (!m_file.is_open()) {
+            return false;
         }
-        return false;
+        m_file << "=== VOXEL ENGINE LOG ===\n\n";
+        m_file.flush();
+        m_running.store(true, std::memory_order_release);
+        m_thread = std::thread([this] { backend_loop(); });
+        return true;
     }
 
     void close() {
-        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_running.exchange(false, std::memory_order_acq_rel)) {
+            if (m_thread.joinable()) {
+                m_thread.join();  // Backend drains the ring before exiting
+            }
+        }
         if (m_file.is_open()) {
             m_file.close();
         }
     }
 
+    // Hot path: claim a ring slot, encode the arguments as tagged raw
+    // values, publish. The category must be a string literal (only the
+    // pointer is stored); everything else is copied into the slot.
     template<typename... Args>
     void log(const char* category, Args&&... args) {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        if (!m_file.is_open()) return;
-
-        m_file << "[" << category << "] ";
-        ((m_file << args), ...);
-        m_file << "\n";
-        m_file.flush();
+        Slot* slot = claim_slot();
+        if (!slot) {
+            return;  // Logger closed or ring full - never block
+        }
+        slot->category = category;
+        slot->kind = Kind::MESSAGE;
+        std::size_t used = 0;
+        (encode(slot->payload, used, std::forward<Args>(args)), ...);
+        slot->used = static_cast<std::uint16_t>(used);
+        publish_slot(slot);
     }
 
     void log_separator() {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        if (!m_file.is_open()) return;
-        m_file << "----------------------------------------\n";
-        m_file.flush();
+        Slot* slot = claim_slot();
+        if (!slot) {
+            return;
+        }
+        slot->category = nullptr;
+        slot->kind = Kind::SEPARATOR;
+        slot->used = 0;
+        publish_slot(slot);
     }
 
-    // Log hex values
+    // Log hex values (cold path: pre-formats into the slot as one string)
     void log_hex(const char* category, const char* label, const void* data, std::size_t size) {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        if (!m_file.is_open()) return;
-
-        const std::uint8_t* bytes = static_cast<const std::uint8_t*>(data);
-        m_file << "[" << category << "] " << label << ": ";
-        for (std::size_t i = 0; i < size; ++i) {
-            char hex[4];
-            std::snprintf(hex, sizeof(hex), "%02X ", bytes[i]);
-            m_file << hex;
+        char buf[SLOT_PAYLOAD];
+        std::size_t len = 0;
+        len += static_cast<std::size_t>(std::snprintf(buf, sizeof(buf), "%s: ", label));
+        const auto* bytes = static_cast<const std::uint8_t*>(data);
+        for (std::size_t i = 0; i < size && len + 4 < sizeof(buf); ++i) {
+            len += static_cast<std::size_t>(
+                std::snprintf(buf + len, sizeof(buf) - len, "%02X ", bytes[i]));
         }
-        m_file << "\n";
-        m_file.flush();
+        log(category, std::string_view(buf, len));
     }
 
-    // Log matrix
+    // Log matrix (cold path, same pre-formatting)
     void log_mat4(const char* category, const char* label, const float* m) {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        if (!m_file.is_open()) return;
-
-        m_file << "[" << category << "] " << label << ":\n";
-        for (int row = 0; row < 4; ++row) {
-            m_file << "  [";
-            for (int col = 0; col < 4; ++col) {
-                char buf[16];
-                std::snprintf(buf, sizeof(buf), "%8.4f", static_cast<double>(m[col * 4 + row]));
-                m_file << buf;
-                if (col < 3) m_file << ", ";
+        char buf[SLOT_PAYLOAD];
+        std::size_t len = 0;
+        len += static_cast<std::size_t>(std::snprintf(buf, sizeof(buf), "%s:\n", label));
+        for (int row = 0; row < 4 && len < sizeof(buf); ++row) {
+            len += static_cast<std::size_t>(
+                std::snprintf(buf + len, sizeof(buf) - len, "  ["));
+            for (int col = 0; col < 4 && len < sizeof(buf); ++col) {
+                len += static_cast<std::size_t>(std::snprintf(
+                    buf + len, sizeof(buf) - len, "%8.4f%s",
+                    static_cast<double>(m[col * 4 + row]), col < 3 ? ", " : ""));
             }
-            m_file << "]\n";
+            len += static_cast<std::size_t>(
+                std::snprintf(buf + len, sizeof(buf) - len, "]\n"));
         }
-        m_file.flush();
+        log(category, std::string_view(buf, std::min(len, sizeof(buf) - 1)));
+    }
+
+    // Messages discarded because the ring was full
+    [[nodiscard]] std::uint64_t dropped_count() const noexcept {
+        return m_dropped.load(std::memory_order_relaxed);
     }
 
 private:
     Logger() = default;
     ~Logger() { close(); }
 
+    // =============================================================================
+    // RING LAYOUT
+    // Bounded MPMC ring (Vyukov sequence scheme) used as MPSC: producers
+    // race on the enqueue cursor with one CAS, the backend thread is the
+    // only consumer. Each slot carries one message's encoded arguments.
+    // =============================================================================
+
+    static constexpr std::size_t SLOT_COUNT = 4096;    // Power of two
+    static constexpr std::size_t SLOT_PAYLOAD = 224;   // Encoded bytes per message
+
+    enum class Kind : std::uint8_t { MESSAGE = 0, SEPARATOR = 1 };
+
+    // Tags prefixing each encoded value in a slot payload
+    enum class Tag : std::uint8_t { I64 = 0, U64 = 1, F64 = 2, BOOL = 3, CHAR = 4, STR = 5 };
+
+    struct Slot {
+        std::atomic<std::uint64_t> sequence;
+        std::uint64_t claimed_pos;
+        const char* category;
+        std::uint16_t used;
+        Kind kind;
+        std::uint8_t payload[SLOT_PAYLOAD];
+    };
+
+    [[nodiscard]] Slot* claim_slot() noexcept {
+        if (!m_running.load(std::memory_order_acquire)) {
+            return nullptr;
+        }
+        std::uint64_t pos = m_enqueue.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot& slot = m_slots[pos & (SLOT_COUNT - 1)];
+            const std::uint64_t seq = slot.sequence.load(std::memory_order_acquire);
+            const auto dif = static_cast<std::int64_t>(seq) - static_cast<std::int64_t>(pos);
+            if (dif == 0) {
+                if (m_enqueue.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    slot.claimed_pos = pos;
+                    return &slot;
+                }
+            } else if (dif < 0) {
+                // Consumer hasn't freed this slot yet: ring full, drop
+                m_dropped.fetch_add(1, std::memory_order_relaxed);
+                return nullptr;
+            } else {
+                pos = m_enqueue.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void publish_slot(Slot* slot) noexcept {
+        slot->sequence.store(slot->claimed_pos + 1, std::memory_order_release);
+    }
+
+    // =============================================================================
+    // ARGUMENT ENCODING (hot path: tag byte + raw memcpy)
+    // =============================================================================
+
+    template<typename T>
+    static void encode(std::uint8_t* payload, std::size_t& used, T&& value) {
+        using Decayed = std::decay_t<T>;
+        if constexpr (std::is_same_v<Decayed, bool>) {
+            encode_raw(payload, used, Tag::BOOL, &value, 1);
+        } else if constexpr (std::is_same_v<Decayed, char>) {
+            encode_raw(payload, used, Tag::CHAR, &value, 1);
+        } else if constexpr (std::is_integral_v<Decayed> && std::is_signed_v<Decayed>) {
+            const std::int64_t v = static_cast<std::int64_t>(value);
+            encode_raw(payload, used, Tag::I64, &v, sizeof(v));
+        } else if constexpr (std::is_integral_v<Decayed>) {
+            const std::uint64_t v = static_cast<std::uint64_t>(value);
+            encode_raw(payload, used, Tag::U64, &v, sizeof(v));
+        } else if constexpr (std::is_floating_point_v<Decayed>) {
+            const double v = static_cast<double>(value);
+            encode_raw(payload, used, Tag::F64, &v, sizeof(v));
+        } else if constexpr (std::is_convertible_v<Decayed, std::string_view>) {
+            encode_string(payload, used, std::string_view(value));
+        } else {
+            // Streamable fallback (rare, pays a format on the hot path)
+            std::ostringstream oss;
+            oss << value;
+            const std::string text = oss.str();
+            encode_string(payload, used, text);
+        }
+    }
+
+    static void encode_raw(std::uint8_t* payload, std::size_t& used,
+                           Tag tag, const void* data, std::size_t size) {
+        if (used + 1 + size > SLOT_PAYLOAD) {
+            return;  // Slot full: truncate the message
+        }
+        payload[used++] = static_cast<std::uint8_t>(tag);
+        std::memcpy(payload + used, data, size);
+        used += size;
+    }
+
+    static void encode_string(std::uint8_t* payload, std::size_t& used, std::string_view text) {
+        if (used + 3 > SLOT_PAYLOAD) {
+            return;
+        }
+        const auto len = static_cast<std::uint16_t>(
+            std::min(text.size(), SLOT_PAYLOAD - used - 3));
+        payload[used++] = static_cast<std::uint8_t>(Tag::STR);
+        std::memcpy(payload + used, &len, sizeof(len));
+        used += sizeof(len);
+        std::memcpy(payload + used, text.data(), len);
+        used += len;
+    }
+
+    // =============================================================================
+    // BACKEND (single consumer: decode, format, write, flush when idle)
+    // =============================================================================
+
+    void backend_loop() {
+        std::uint64_t reported_drops = 0;
+        bool need_flush = false;
+        while (true) {
+            const bool running = m_running.load(std::memory_order_acquire);
+            bool drained = true;
+
+            Slot* slot = nullptr;
+            while ((slot = try_dequeue()) != nullptr) {
+                format_slot(*slot);
+                release_slot(slot);
+                need_flush = true;
+                drained = false;
+            }
+
+            const std::uint64_t drops = m_dropped.load(std::memory_order_relaxed);
+            if (drops != reported_drops) {
+                m_file << "[Logger] " << (drops - reported_drops)
+                       << " messages dropped (ring full)\n";
+                reported_drops = drops;
+                need_flush = true;
+            }
+
+            if (drained) {
+                if (need_flush) {
+                    m_file.flush();
+                    need_flush = false;
+                }
+                if (!running) {
+                    return;  // Stopped and fully drained
+                }
+                std::this_thread::sleep_for(std::chrono::microseconds(500));
+            }
+        }
+    }
+
+    [[nodiscard]] Slot* try_dequeue() noexcept {
+        Slot& slot = m_slots[m_dequeue & (SLOT_COUNT - 1)];
+        const std::uint64_t seq = slot.sequence.load(std::memory_order_acquire);
+        if (seq != m_dequeue + 1) {
+            return nullptr;  // Next slot not yet published
+        }
+        return &slot;
+    }
+
+    void release_slot(Slot* slot) noexcept {
+        slot->sequence.store(m_dequeue + SLOT_COUNT, std::memory_order_release);
+        ++m_dequeue;
+    }
+
+    void format_slot(const Slot& slot) {
+        if (slot.kind == Kind::SEPARATOR) {
+            m_file << "----------------------------------------\n";
+            return;
+        }
+        m_file << "[" << slot.category << "] ";
+        std::size_t offset = 0;
+        while (offset < slot.used) {
+            const Tag tag = static_cast<Tag>(slot.payload[offset++]);
+            switch (tag) {
+                case Tag::I64: {
+                    std::int64_t v;
+                    std::memcpy(&v, slot.payload + offset, sizeof(v));
+                    offset += sizeof(v);
+                    m_file << v;
+                    break;
+                }
+                case Tag::U64: {
+                    std::uint64_t v;
+                    std::memcpy(&v, slot.payload + offset, sizeof(v));
+                    offset += sizeof(v);
+                    m_file << v;
+                    break;
+                }
+                case Tag::F64: {
+                    double v;
+                    std::memcpy(&v, slot.payload + offset, sizeof(v));
+                    offset += sizeof(v);
+                    m_file << v;
+                    break;
+                }
+                case Tag::BOOL: {
+                    m_file << (slot.payload[offset++] != 0 ? "true" : "false");
+                    break;
+                }
+                case Tag::CHAR: {
+                    m_file << static_cast<char>(slot.payload[offset++]);
+                    break;
+                }
+                case Tag::STR: {
+                    std::uint16_t len;
+                    std::memcpy(&len, slot.payload + offset, sizeof(len));
+                    offset += sizeof(len);
+                    m_file.write(reinterpret_cast<const char*>(slot.payload + offset), len);
+                    offset += len;
+                    break;
+                }
+            }
+        }
+        m_file << "\n";
+    }
+
+    // Ring storage: sequence numbers seeded with the slot index (Vyukov)
+    struct SlotArray {
+        SlotArray() {
+            for (std::size_t i = 0; i < SLOT_COUNT; ++i) {
+                slots[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+        std::array<Slot, SLOT_COUNT> slots;
+        Slot& operator[](std::uint64_t index) noexcept { return slots[index]; }
+    };
+
     std::ofstream m_file;
-    std::mutex m_mutex;
+    std::thread m_thread;
+    std::atomic<bool> m_running{false};
+
+    SlotArray m_slots;
+    alignas(64) std::atomic<std::uint64_t> m_enqueue{0};
+    alignas(64) std::uint64_t m_dequeue = 0;  // Backend thread only
+    std::atomic<std::uint64_t> m_dropped{0};
 };
 
 // Convenience macros
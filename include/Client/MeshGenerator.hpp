@@ -10,8 +10,10 @@
 #include "Shared/Chunk.hpp"
 
 #include <array>
+#include <bit>
 #include <cstdint>
 #include <functional>
+#include <vector>
 
 namespace voxel::client {
 
@@ -78,6 +80,31 @@ public:
     // Generate mesh without neighbor data (internal faces only)
     void generate_simple(const Chunk& chunk, ChunkMesh& out_mesh);
 
+    // Re-mesh only the slices touched by the given dirty-region mask
+    // (Chunk::dirty_regions) and splice them into mesh, which must hold
+    // this chunk's previous full-resolution output. Falls back to a full
+    // generate() when there is nothing to splice into (first mesh, LOD
+    // mesh, flooded mask). A single block edit re-runs ~3 of 64 slices
+    // per axis instead of all of them.
+    void generate_incremental(
+        const Chunk& chunk,
+        ChunkMesh& mesh,
+        std::uint64_t dirty_regions,
+        const NeighborAccessor& neighbor_accessor = nullptr
+    );
+
+    // Maximum supported LOD level (8x downsampled voxels)
+    static constexpr std::uint8_t MAX_LOD = 3;
+
+    // Generate a reduced-detail mesh at 2^lod downsampled resolution
+    // (lod 1-3). Distant chunks need vertex counts that scale with view
+    // distance squared, not cubed; a coarse cell is solid if any of its
+    // sub-voxels is, so silhouettes stay hole-free
+    void generate_lod(const Chunk& chunk, ChunkMesh& out_mesh, std::uint8_t lod);
+
+    // Same, operating on a raw voxel snapshot (background mesh workers)
+    void generate_lod_from_data(const Voxel* voxels, ChunkMesh& out_mesh, std::uint8_t lod);
+
     // =============================================================================
     // CONFIGURATION
     // =============================================================================
@@ -97,9 +124,23 @@ private:
     // INTERNAL TYPES
     // =============================================================================
 
+    // Output stream a meshing pass feeds. The mesher runs the face-mask
+    // and greedy stages once per pass, specialized at compile time so
+    // the opaque hot path carries no transparency branches and the
+    // translucent path skips the bitwise column machinery entirely.
+    enum class MeshPass : std::uint8_t {
+        OPAQUE,      // Bitwise column culling, quads into the opaque stream
+        TRANSLUCENT  // Scalar per-type rules, quads into the translucent stream
+    };
+
     // Occupancy mask for greedy meshing (64x64 = 4096 bits = 64 uint64_t)
     using SliceMask = std::array<std::uint64_t, SIZE>;
 
+    // Column occupancy: one 64-bit mask per column, bit n = voxel n along
+    // the column axis is opaque. CHUNK_SIZE is 64, so a column fits a
+    // uint64_t exactly and face culling becomes shifts and ANDs.
+    using ColumnMask = std::array<std::uint64_t, SIZE_SQ>;
+
     // Face data for greedy meshing
     struct FaceData {
         std::uint16_t voxel_type;
@@ -122,14 +163,35 @@ private:
     // GREEDY MESHING IMPLEMENTATION
     // =============================================================================
 
+    // Build per-axis opacity columns and collect non-opaque voxels
+    // (single pass over the volume, shared by all 6 face directions)
+    void build_occupancy(const Chunk& chunk);
+
     // Build face visibility mask for a given axis direction
+    template <MeshPass Pass>
     void build_face_masks(
         const Chunk& chunk,
         Face face,
         const NeighborAccessor& neighbor_accessor
     );
 
+    // Scalar path for transparent/fluid voxels (full culling rules)
+    void process_special_voxel(
+        const Chunk& chunk,
+        std::uint32_t x, std::uint32_t y, std::uint32_t z,
+        Face face,
+        const NeighborAccessor& neighbor_accessor
+    );
+
+    // Store face data for a visible face (marks slice occupancy)
+    void emit_face(
+        std::uint32_t x, std::uint32_t y, std::uint32_t z,
+        Face face,
+        const FaceData& data
+    );
+
     // Perform greedy meshing on a 2D slice
+    template <MeshPass Pass>
     void greedy_mesh_slice(
         std::uint32_t slice_coord,
         Face face,
@@ -139,6 +201,16 @@ private:
     // Check if voxel at position is opaque
     [[nodiscard]] bool is_opaque(const Chunk& chunk, LocalCoord x, LocalCoord y, LocalCoord z) const;
 
+    // Vertex light for a face, sampled from the cell the face looks into
+    // (sun/torch nibbles scaled to the 8-bit channel PackedVertex packs).
+    // Boundary faces without neighbor data bake fully lit.
+    [[nodiscard]] std::uint8_t face_light(
+        const Chunk& chunk,
+        std::uint32_t x, std::uint32_t y, std::uint32_t z,
+        Face face,
+        const NeighborAccessor& neighbor_accessor
+    ) const;
+
     // Get voxel with neighbor fallback
     [[nodiscard]] Voxel get_voxel_or_neighbor(
         const Chunk& chunk,
@@ -154,7 +226,17 @@ private:
         const NeighborAccessor& neighbor_accessor
     ) const;
 
-    // Add a quad to the mesh
+    // Emit one coarse cell face as a step x step quad
+    void add_lod_face_quad(
+        ChunkMesh& mesh,
+        std::uint32_t x, std::uint32_t y, std::uint32_t z,
+        std::uint32_t step,
+        Face face,
+        const FaceData& data
+    );
+
+    // Add a quad to the pass's output stream
+    template <MeshPass Pass>
     void add_face_quad(
         ChunkMesh& mesh,
         std::uint32_t x, std::uint32_t y, std::uint32_t z,
@@ -167,8 +249,27 @@ private:
     MeshGenConfig m_config;
 
     // Working buffers (reused across generate calls)
-    std::array<FaceSlice, SIZE> m_face_slices;   // 64 slices of 64x64 faces
-    std::array<SliceMask, SIZE> m_visited_masks; // Visited tracking for greedy
+    std::array<FaceSlice, SIZE> m_face_slices;      // 64 slices of 64x64 faces
+    std::array<SliceMask, SIZE> m_slice_occupancy;  // Cells holding valid face data
+
+    // Opacity columns along each axis (32 KiB each, built once per chunk)
+    ColumnMask m_occ_x;  // [y * SIZE + z], bit = x
+    ColumnMask m_occ_y;  // [x * SIZE + z], bit = y
+    ColumnMask m_occ_z;  // [x * SIZE + y], bit = z
+
+    // Non-air non-opaque voxels (fluids, glass) - packed chunk indices,
+    // handled by the scalar rule path since they cull by type and level
+    std::vector<std::uint32_t> m_special_voxels;
+
+    // Coarse cell grid for LOD meshing (0 = empty, else voxel type)
+    std::vector<std::uint16_t> m_lod_cells;
+
+    // Scratch buffers for incremental splicing: rebuilt slices are meshed
+    // into m_incr_mesh, then merged with the surviving quads (parked in
+    // m_old_vertices) in bucket order
+    ChunkMesh m_incr_mesh;
+    std::vector<PackedVertex> m_old_vertices;
+    std::vector<std::uint16_t> m_old_counts;
 
     // Statistics
     std::uint32_t m_stats_faces = 0;
@@ -11,6 +11,8 @@
 #include "Client/MeshGenerator.hpp"
 #include "Client/ChunkMesh.hpp"
 
+#include <algorithm>
+#include <cstring>
 #include <queue>
 #include <mutex>
 #include <atomic>
@@ -18,6 +20,7 @@
 #include <unordered_set>
 #include <memory>
 #include <functional>
+#include <vector>
 
 namespace voxel::client {
 
@@ -32,7 +35,13 @@ struct MeshTaskResult {
 
 // =============================================================================
 // MESH TASK QUEUE
-// Manages background mesh generation with priority and deduplication
+// Manages background mesh generation with priority and deduplication.
+// Submission does not hand tasks to the pool directly: queued remeshes
+// sit in a camera-ordered ready list, and each pool worker pops the
+// nearest in-frustum chunk at execution time. Because ordering is
+// resolved at pop (not at push), camera movement reprioritizes the
+// backlog in place, and tasks whose chunk was unloaded or re-dirtied
+// before a worker reached them are cancelled without ever being meshed.
 // =============================================================================
 class MeshTaskQueue {
 public:
@@ -50,44 +59,108 @@ public:
         shutdown();
     }
     
+    // =============================================================================
+    // LOD SELECTION
+    // Distant chunks are meshed at downsampled resolution so vertex
+    // memory and meshing cost scale with view distance squared, not cubed
+    // =============================================================================
+
+    // Chebyshev distance thresholds in chunks: full detail up to 8,
+    // then 2x/4x/8x downsampled voxels further out
+    static constexpr std::int64_t LOD_DISTANCES[MeshGenerator::MAX_LOD] = {8, 16, 24};
+
+    // Update the camera chunk used for distance-based LOD selection and
+    // task ordering. Queued tasks are re-prioritized in place, so a
+    // backlog built up before a teleport drains nearest-first afterwards
+    void set_camera_chunk(ChunkPosition pos) {
+        std::lock_guard<std::mutex> lock(m_pending_mutex);
+        m_camera_chunk = pos;
+        m_camera_valid = true;
+        for (PendingTask& task : m_pending_tasks) {
+            task.priority = priority_locked(task.pos, task.in_frustum);
+        }
+    }
+
+    [[nodiscard]] static std::uint8_t lod_for_distance(std::int64_t chunk_distance) noexcept {
+        for (std::uint8_t level = 0; level < MeshGenerator::MAX_LOD; ++level) {
+            if (chunk_distance <= LOD_DISTANCES[level]) {
+                return level;
+            }
+        }
+        return MeshGenerator::MAX_LOD;
+    }
+
+    // Positions whose built LOD no longer matches the camera distance.
+    // The caller re-queues them with fresh snapshots; positions already
+    // queued for a rebuild are skipped
+    [[nodiscard]] std::vector<ChunkPosition> collect_lod_transitions(std::size_t max_results = 32) {
+        std::vector<ChunkPosition> transitions;
+
+        std::lock_guard<std::mutex> lock(m_pending_mutex);
+        for (const auto& [pos, built_lod] : m_built_lods) {
+            if (transitions.size() >= max_results) {
+                break;
+            }
+            if (m_queued_positions.count(pos) > 0) {
+                continue;
+            }
+            if (desired_lod_locked(pos) != built_lod) {
+                transitions.push_back(pos);
+            }
+        }
+        return transitions;
+    }
+
+    // Drop LOD bookkeeping for an unloaded chunk, cancelling any task
+    // still queued for it
+    void forget_chunk(ChunkPosition pos) {
+        std::lock_guard<std::mutex> lock(m_pending_mutex);
+        m_built_lods.erase(pos);
+        cancel_locked(pos);
+    }
+
     // =============================================================================
     // TASK SUBMISSION
     // =============================================================================
-    
-    // Queue a chunk for mesh regeneration
-    // Deduplicates: if chunk is already queued, skip
+
+    // Queue a chunk for mesh regeneration. in_frustum ranks the task:
+    // visible chunks drain before off-screen ones, nearest first. A
+    // position that is already queued is replaced - the stale snapshot
+    // is cancelled and never meshed
     void queue_remesh(
         ChunkPosition pos,
         const Chunk& chunk,
-        VoxelAccessor voxel_accessor
+        VoxelAccessor voxel_accessor,
+        bool in_frustum = true
     ) {
-        {
-            std::lock_guard<std::mutex> lock(m_pending_mutex);
-            
-            // Skip if already queued
-            if (m_queued_positions.count(pos) > 0) {
-                return;
-            }
-            m_queued_positions.insert(pos);
-        }
-        
-        // Capture chunk data (copy voxels for thread safety)
-        auto chunk_data = std::make_shared<std::vector<Voxel>>();
-        chunk_data->reserve(CHUNK_VOLUME);
-        for (std::uint32_t i = 0; i < CHUNK_VOLUME; ++i) {
-            chunk_data->push_back(chunk.get_voxel_by_index(i));
+        // Zero-copy publication: share the chunk's cached immutable
+        // snapshot. On an unmodified chunk this is a refcount bump; only
+        // a chunk written since the last snapshot pays a single rebuild.
+        PendingTask task;
+        task.pos = pos;
+        task.chunk_pos = chunk.position();
+        task.chunk_data = chunk.snapshot();
+        task.voxel_accessor = std::move(voxel_accessor);
+        task.in_frustum = in_frustum;
+        enqueue_task(std::move(task));
+    }
+
+    // Queue a remesh from a padded snapshot (preferred path)
+    // The snapshot carries the chunk plus its six boundary planes, so the
+    // worker never calls back into the world: no voxel_accessor, no world
+    // lock traffic during cross-chunk face culling
+    void queue_remesh(std::shared_ptr<const PaddedChunkSnapshot> snapshot, bool in_frustum = true) {
+        if (!snapshot) {
+            return;
         }
-        
-        ChunkPosition chunk_pos = chunk.position();
-        
-        m_pending_count++;
-        
-        // Submit to thread pool
-        m_pool.submit_detached([this, pos, chunk_data, chunk_pos, voxel_accessor]() {
-            generate_mesh(pos, *chunk_data, chunk_pos, voxel_accessor);
-        });
+        PendingTask task;
+        task.pos = snapshot->position;
+        task.chunk_pos = snapshot->position;
+        task.snapshot = std::move(snapshot);
+        task.in_frustum = in_frustum;
+        enqueue_task(std::move(task));
     }
-    
+
     // Queue multiple chunks for remesh (batch operation)
     void queue_remesh_batch(
         const std::vector<ChunkPosition>& positions,
@@ -101,6 +174,15 @@ public:
             }
         }
     }
+
+    // Drop a queued task whose chunk no longer matters (unloaded).
+    // Tasks already running on a worker finish normally; their result is
+    // simply stale and cheap to discard at integration time.
+    // Returns true if a queued task was cancelled
+    bool cancel_remesh(ChunkPosition pos) {
+        std::lock_guard<std::mutex> lock(m_pending_mutex);
+        return cancel_locked(pos);
+    }
     
     // =============================================================================
     // RESULT RETRIEVAL
@@ -155,187 +237,243 @@ public:
     }
     
 private:
-    void generate_mesh(
-        ChunkPosition pos,
-        const std::vector<Voxel>& chunk_data,
-        ChunkPosition chunk_pos,
-        VoxelAccessor voxel_accessor
-    ) {
-        // Create a temporary chunk wrapper for the mesh generator
-        // This is a bit of a hack but avoids copying the entire Chunk class
-        struct TempChunk {
-            const std::vector<Voxel>& data;
-            ChunkPosition pos;
-            
-            [[nodiscard]] Voxel get_voxel(LocalCoord x, LocalCoord y, LocalCoord z) const {
-                if (x < 0 || x >= 64 || y < 0 || y >= 64 || z < 0 || z >= 64) {
-                    return Voxel(VoxelType::AIR);
-                }
-                VoxelIndex idx = coord::to_index(x, y, z);
-                return data[idx];
+    // A remesh waiting for a worker. Owns everything the mesher needs,
+    // so cancellation just drops the entry - no pool interaction
+    struct PendingTask {
+        ChunkPosition pos{};
+        ChunkPosition chunk_pos{};
+        std::shared_ptr<const PaddedChunkSnapshot> snapshot;  // Preferred path
+        std::shared_ptr<const Voxel[]> chunk_data;            // Accessor path
+        VoxelAccessor voxel_accessor;
+        std::int64_t priority = 0;   // Lower executes first
+        bool in_frustum = true;
+        std::uint64_t sequence = 0;  // FIFO tiebreak among equal priorities
+    };
+
+    // Off-screen tasks rank behind every visible one regardless of
+    // distance (same scheme as the chunk streamer)
+    static constexpr std::int64_t OFF_SCREEN_PENALTY = 1 << 20;
+
+    // Camera-distance priority (requires m_pending_mutex held)
+    [[nodiscard]] std::int64_t priority_locked(ChunkPosition pos, bool in_frustum) const {
+        std::int64_t distance_sq = 0;
+        if (m_camera_valid) {
+            const std::int64_t dx = pos.x - m_camera_chunk.x;
+            const std::int64_t dy = pos.y - m_camera_chunk.y;
+            const std::int64_t dz = pos.z - m_camera_chunk.z;
+            distance_sq = dx * dx + dy * dy + dz * dz;
+        }
+        return distance_sq + (in_frustum ? 0 : OFF_SCREEN_PENALTY);
+    }
+
+    // Remove a waiting entry for the position (requires m_pending_mutex
+    // held). A task that has already been popped by a worker is not
+    // affected - it finishes and its result is discarded by the caller
+    bool cancel_locked(ChunkPosition pos) {
+        for (auto it = m_pending_tasks.begin(); it != m_pending_tasks.end(); ++it) {
+            if (it->pos == pos) {
+                m_pending_tasks.erase(it);
+                m_queued_positions.erase(pos);
+                m_pending_count--;
+                return true;
             }
-            
-            [[nodiscard]] const ChunkPosition& position() const { return pos; }
-        };
-        
-        TempChunk temp_chunk{chunk_data, chunk_pos};
-        
-        // Create mesh generator (thread-local to avoid contention)
-        thread_local MeshGenerator mesh_gen;
-        
-        ChunkMesh mesh;
-        
-        // Generate mesh with neighbor accessor
-        // The neighbor accessor calls back to the main world for cross-chunk data
-        auto neighbor_accessor = [&voxel_accessor, &temp_chunk](ChunkCoord wx, ChunkCoord wy, ChunkCoord wz) -> Voxel {
-            // Convert to chunk-local space
-            ChunkCoord chunk_origin_x = temp_chunk.pos.x << 6;
-            ChunkCoord chunk_origin_y = temp_chunk.pos.y << 6;
-            ChunkCoord chunk_origin_z = temp_chunk.pos.z << 6;
-            
-            // If within this chunk, use local data
-            LocalCoord lx = static_cast<LocalCoord>(wx - chunk_origin_x);
-            LocalCoord ly = static_cast<LocalCoord>(wy - chunk_origin_y);
-            LocalCoord lz = static_cast<LocalCoord>(wz - chunk_origin_z);
-            
-            if (lx >= 0 && lx < 64 && ly >= 0 && ly < 64 && lz >= 0 && lz < 64) {
-                return temp_chunk.get_voxel(lx, ly, lz);
+        }
+        return false;
+    }
+
+    // Park a task in the ready list and wake one pool worker. The worker
+    // does not run this task specifically - it runs whichever task ranks
+    // best once it actually gets scheduled
+    void enqueue_task(PendingTask task) {
+        {
+            std::lock_guard<std::mutex> lock(m_pending_mutex);
+
+            // Re-dirtied while still queued: the stale snapshot is
+            // replaced, keeping one live task per position
+            cancel_locked(task.pos);
+
+            task.priority = priority_locked(task.pos, task.in_frustum);
+            task.sequence = m_next_sequence++;
+            m_queued_positions.insert(task.pos);
+            m_pending_tasks.push_back(std::move(task));
+        }
+
+        m_pending_count++;
+        m_pool.submit_detached([this]() { run_best_task(); });
+    }
+
+    // Pop and execute the best-ranked ready task. LOD is selected here,
+    // at execution time, so a task queued before a long camera move is
+    // built at the level that matches where the camera is now
+    void run_best_task() {
+        PendingTask task;
+        std::uint8_t lod = 0;
+        {
+            std::lock_guard<std::mutex> lock(m_pending_mutex);
+            if (m_pending_tasks.empty()) {
+                return; // Our task was cancelled or replaced - nothing to do
             }
-            
-            // Otherwise query world (this is the cross-chunk case)
-            return voxel_accessor(wx, wy, wz);
+            auto best = std::min_element(
+                m_pending_tasks.begin(), m_pending_tasks.end(),
+                [](const PendingTask& a, const PendingTask& b) {
+                    if (a.priority != b.priority) {
+                        return a.priority < b.priority;
+                    }
+                    return a.sequence < b.sequence;
+                });
+            task = std::move(*best);
+            m_pending_tasks.erase(best);
+            m_queued_positions.erase(task.pos);
+            lod = desired_lod_locked(task.pos);
+        }
+
+        if (task.snapshot) {
+            generate_mesh_padded(task.pos, *task.snapshot, lod);
+        } else {
+            generate_mesh(task.pos, task.chunk_data.get(), task.chunk_pos,
+                          task.voxel_accessor, lod);
+        }
+    }
+
+    // Desired LOD for a chunk given the current camera chunk
+    // (requires m_pending_mutex held)
+    [[nodiscard]] std::uint8_t desired_lod_locked(ChunkPosition pos) const {
+        if (!m_camera_valid) {
+            return 0;
+        }
+        const auto axis = [](ChunkCoord a, ChunkCoord b) noexcept {
+            const std::int64_t d = static_cast<std::int64_t>(a) - static_cast<std::int64_t>(b);
+            return d < 0 ? -d : d;
         };
-        
-        // Generate using a simple face-by-face approach for the copied data
-        // This is a simplified version since we can't use the full Chunk interface
-        generate_mesh_from_data(chunk_data, chunk_pos, mesh, neighbor_accessor);
-        
-        // Store result
+        const std::int64_t distance = std::max(
+            axis(pos.x, m_camera_chunk.x),
+            std::max(axis(pos.y, m_camera_chunk.y), axis(pos.z, m_camera_chunk.z))
+        );
+        return lod_for_distance(distance);
+    }
+
+    // Store a finished mesh and retire the position's queue entry
+    void finish_task(ChunkPosition pos, ChunkMesh&& mesh, std::uint8_t lod) {
         {
             std::lock_guard<std::mutex> lock(m_results_mutex);
             m_completed_results.push(MeshTaskResult{pos, std::move(mesh), true});
         }
-        
+
         // Update counters
         m_pending_count--;
         m_completed_count++;
-        
-        // Remove from queued set
+
+        // Record the level this mesh was built at, so LOD transitions
+        // can be detected later (the queued-set entry was already
+        // retired when a worker popped the task)
         {
             std::lock_guard<std::mutex> lock(m_pending_mutex);
-            m_queued_positions.erase(pos);
+            m_built_lods[pos] = lod;
         }
     }
-    
-    void generate_mesh_from_data(
-        const std::vector<Voxel>& data,
+
+    void generate_mesh(
+        ChunkPosition pos,
+        const Voxel* chunk_data,
         ChunkPosition chunk_pos,
-        ChunkMesh& out_mesh,
-        const NeighborAccessor& neighbor_accessor
+        VoxelAccessor voxel_accessor,
+        std::uint8_t lod
     ) {
-        // Simple naive mesh generation (per-face)
-        // For production, use greedy meshing
-        
-        out_mesh.vertices.clear();
-        out_mesh.indices.clear();
-        out_mesh.is_empty = true;
-        
-        ChunkCoord origin_x = chunk_pos.x << 6;
-        ChunkCoord origin_y = chunk_pos.y << 6;
-        ChunkCoord origin_z = chunk_pos.z << 6;
-        
-        // Face normal directions
-        static constexpr int DX[] = {-1, 1, 0, 0, 0, 0};
-        static constexpr int DY[] = {0, 0, -1, 1, 0, 0};
-        static constexpr int DZ[] = {0, 0, 0, 0, -1, 1};
-        
-        std::uint32_t vertex_count = 0;
-        
-        for (LocalCoord x = 0; x < 64; ++x) {
-            for (LocalCoord y = 0; y < 64; ++y) {
-                for (LocalCoord z = 0; z < 64; ++z) {
-                    VoxelIndex idx = coord::to_index(x, y, z);
-                    const Voxel& voxel = data[idx];
-                    
-                    if (voxel.is_air()) continue;
-                    
-                    // Check each face
-                    for (int face = 0; face < 6; ++face) {
-                        ChunkCoord nx = origin_x + x + DX[face];
-                        ChunkCoord ny = origin_y + y + DY[face];
-                        ChunkCoord nz = origin_z + z + DZ[face];
-                        
-                        Voxel neighbor = neighbor_accessor(nx, ny, nz);
-                        
-                        // Skip if neighbor is solid
-                        if (!neighbor.is_air()) continue;
-                        
-                        // Add face vertices
-                        add_face(out_mesh, x, y, z, face, voxel.type_id(), vertex_count);
-                        out_mesh.is_empty = false;
-                    }
-                }
-            }
+        // Distant chunks skip the callback mesher entirely: the coarse
+        // grid never samples neighbor chunks
+        if (lod > 0) {
+            thread_local MeshGenerator lod_gen;
+            ChunkMesh mesh;
+            lod_gen.generate_lod_from_data(chunk_data, mesh, lod);
+            mesh.position = chunk_pos;
+            const std::uint8_t built_lod = mesh.lod;
+            finish_task(pos, std::move(mesh), built_lod);
+            return;
         }
+
+        // Rehydrate the snapshot into the thread-local scratch chunk and
+        // run the real greedy mesher. Cross-chunk neighbor reads still go
+        // through the voxel accessor (world-lock traffic at boundaries) -
+        // the padded-snapshot overload avoids even that.
+        thread_local MeshGenerator mesh_gen;
+        Chunk& scratch = scratch_chunk(chunk_data, chunk_pos);
+
+        ChunkMesh mesh;
+        mesh_gen.generate(scratch, mesh, voxel_accessor);
+        mesh.position = chunk_pos;
+
+        finish_task(pos, std::move(mesh), 0);
     }
     
-    void add_face(ChunkMesh& mesh, LocalCoord x, LocalCoord y, LocalCoord z, 
-                  int face, std::uint16_t block_type, std::uint32_t& vertex_count) {
-        // Face vertices in local chunk space
-        // Simplified - just create 4 vertices per face
-        
-        static constexpr float FACE_VERTICES[6][4][3] = {
-            // -X face
-            {{0,0,0}, {0,0,1}, {0,1,1}, {0,1,0}},
-            // +X face
-            {{1,0,1}, {1,0,0}, {1,1,0}, {1,1,1}},
-            // -Y face
-            {{0,0,0}, {1,0,0}, {1,0,1}, {0,0,1}},
-            // +Y face
-            {{0,1,1}, {1,1,1}, {1,1,0}, {0,1,0}},
-            // -Z face
-            {{1,0,0}, {0,0,0}, {0,1,0}, {1,1,0}},
-            // +Z face
-            {{0,0,1}, {1,0,1}, {1,1,1}, {0,1,1}}
-        };
-        
-        static constexpr std::uint8_t FACE_NORMALS[6] = {0, 1, 2, 3, 4, 5};
-        
-        for (int i = 0; i < 4; ++i) {
-            PackedVertex v;
-            v.pack_position(
-                static_cast<std::uint8_t>(x) + static_cast<std::uint8_t>(FACE_VERTICES[face][i][0]),
-                static_cast<std::uint8_t>(y) + static_cast<std::uint8_t>(FACE_VERTICES[face][i][1]),
-                static_cast<std::uint8_t>(z) + static_cast<std::uint8_t>(FACE_VERTICES[face][i][2])
-            );
-            v.pack_texcoord(
-                (i == 1 || i == 2) ? 1 : 0,
-                (i == 2 || i == 3) ? 1 : 0
-            );
-            v.pack_normal(FACE_NORMALS[face]);
-            v.pack_ao(3); // No AO for now
-            v.pack_block_type(block_type);
-            
-            mesh.vertices.push_back(v);
+    void generate_mesh_padded(ChunkPosition pos, const PaddedChunkSnapshot& snapshot, std::uint8_t lod) {
+        ChunkMesh mesh;
+
+        if (lod > 0) {
+            // Coarse cells never sample across the chunk boundary, so
+            // the padding planes go unused at reduced detail
+            thread_local MeshGenerator lod_gen;
+            lod_gen.generate_lod_from_data(snapshot.center.get(), mesh, lod);
+        } else {
+            generate_mesh_from_snapshot(snapshot, mesh);
         }
-        
-        // Add indices (two triangles per face)
-        mesh.indices.push_back(vertex_count + 0);
-        mesh.indices.push_back(vertex_count + 1);
-        mesh.indices.push_back(vertex_count + 2);
-        mesh.indices.push_back(vertex_count + 0);
-        mesh.indices.push_back(vertex_count + 2);
-        mesh.indices.push_back(vertex_count + 3);
-        
-        vertex_count += 4;
+        mesh.position = pos;
+
+        const std::uint8_t built_lod = mesh.lod;
+        finish_task(pos, std::move(mesh), built_lod);
+    }
+
+    void generate_mesh_from_snapshot(
+        const PaddedChunkSnapshot& snapshot,
+        ChunkMesh& out_mesh
+    ) {
+        // Greedy mesher against the rehydrated snapshot; every neighbor
+        // read resolves inside the snapshot's boundary planes, so the
+        // worker never calls back into the world
+        thread_local MeshGenerator mesh_gen;
+        Chunk& scratch = scratch_chunk(snapshot.center.get(), snapshot.position);
+
+        const ChunkCoord origin_x = coord::chunk_to_world(snapshot.position.x);
+        const ChunkCoord origin_y = coord::chunk_to_world(snapshot.position.y);
+        const ChunkCoord origin_z = coord::chunk_to_world(snapshot.position.z);
+
+        auto neighbor_accessor = [&snapshot, origin_x, origin_y, origin_z](
+            ChunkCoord wx, ChunkCoord wy, ChunkCoord wz) -> Voxel {
+            return snapshot.sample(
+                static_cast<LocalCoord>(wx - origin_x),
+                static_cast<LocalCoord>(wy - origin_y),
+                static_cast<LocalCoord>(wz - origin_z));
+        };
+
+        mesh_gen.generate(scratch, out_mesh, neighbor_accessor);
+    }
+
+    // Rehydrate a captured voxel snapshot into a reusable thread-local
+    // Chunk so the greedy mesher can run against the full Chunk
+    // interface. The 1 MiB memcpy is noise next to the meshing itself.
+    [[nodiscard]] static Chunk& scratch_chunk(const Voxel* data, ChunkPosition pos) {
+        thread_local Chunk scratch{ChunkPosition{0, 0, 0}};
+        scratch.set_position(pos);
+        std::memcpy(scratch.data(), data, Chunk::DATA_SIZE_BYTES);
+        return scratch;
     }
     
     ThreadPool m_pool;
     
-    // Pending tasks tracking
+    // Pending tasks tracking. m_pending_tasks is the camera-ordered
+    // ready list (linear min-scan at pop: the backlog is tens of
+    // entries, and a flat vector keeps reprioritization a plain loop);
+    // m_queued_positions mirrors it for O(1) dedup checks
     std::mutex m_pending_mutex;
+    std::vector<PendingTask> m_pending_tasks;
     std::unordered_set<ChunkPosition> m_queued_positions;
+    std::uint64_t m_next_sequence = 0;
     std::atomic<std::size_t> m_pending_count;
+
+    // LOD state (guarded by m_pending_mutex): camera chunk for distance
+    // selection, and the level each position's current mesh was built at
+    ChunkPosition m_camera_chunk;
+    bool m_camera_valid = false;
+    std::unordered_map<ChunkPosition, std::uint8_t> m_built_lods;
     
     // Completed results
     mutable std::mutex m_results_mutex;
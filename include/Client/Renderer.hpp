@@ -10,6 +10,7 @@
 #include "Client/ChunkMesh.hpp"
 #include "Client/TextureManager.hpp"
 
+#include <array>
 #include <vector>
 #include <unordered_map>
 #include <memory>
@@ -54,17 +55,152 @@ private:
     void* m_sync = nullptr;  // GLsync
 };
 
+// =============================================================================
+// STAGING RING - TRIPLE-BUFFERED PERSISTENT-MAPPED UPLOAD PATH
+// One persistently mapped buffer split into three per-frame regions.
+// Mesh data is memcpy'd into the current region and copied GPU-side into
+// the pooled arenas with glCopyNamedBufferSubData, so uploads never take
+// the driver's synchronous glNamedBufferSubData path. Each region is
+// fenced at end of frame and only handed back to the CPU once the GPU
+// has drained it (three frames in flight).
+// =============================================================================
+class StagingRing {
+public:
+    static constexpr std::uint32_t REGION_COUNT = 3;
+    static constexpr std::size_t INVALID_OFFSET = ~std::size_t{0};
+
+    StagingRing() = default;
+    ~StagingRing();
+
+    StagingRing(const StagingRing&) = delete;
+    StagingRing& operator=(const StagingRing&) = delete;
+
+    // Allocate REGION_COUNT regions of region_size bytes each
+    bool create(std::size_t region_size);
+    void destroy();
+
+    [[nodiscard]] bool is_valid() const noexcept { return m_buffer.is_valid(); }
+    [[nodiscard]] std::uint32_t id() const noexcept { return m_buffer.id(); }
+
+    // Rotate to the next region, waiting on its fence if the GPU still
+    // owns it (only stalls when more than REGION_COUNT frames are in flight)
+    void begin_frame();
+
+    // Place the fence covering everything staged this frame
+    void end_frame();
+
+    // Reserve bytes in the current region; returns the buffer-wide byte
+    // offset, or INVALID_OFFSET when the region is exhausted (caller
+    // falls back to a direct upload)
+    [[nodiscard]] std::size_t allocate(std::size_t bytes);
+
+    // Write into a reservation (memcpy to the persistent mapping)
+    void write(std::size_t offset, const void* data, std::size_t bytes);
+
+private:
+    PersistentBuffer m_buffer;          // REGION_COUNT * m_region_size bytes
+    std::size_t m_region_size = 0;
+    std::uint32_t m_region = 0;         // Region owned by the CPU this frame
+    std::size_t m_region_used = 0;      // Bytes reserved in the current region
+    std::array<void*, REGION_COUNT> m_fences{};  // GLsync per region
+};
+
+// =============================================================================
+// GPU PASS TIMERS
+// GL_TIME_ELAPSED query scopes around each render pass. Queries are
+// multi-buffered across frames so results are read back only once the
+// GPU has long finished them - harvesting never stalls the pipeline.
+// Only one GL_TIME_ELAPSED query may be active at a time, so passes are
+// scoped sequentially (never nested).
+// =============================================================================
+class GpuPassTimers {
+public:
+    static constexpr std::uint32_t FRAMES_IN_FLIGHT = 4;
+    static constexpr std::uint32_t MAX_PASSES = 8;
+
+    GpuPassTimers() = default;
+    ~GpuPassTimers();
+
+    GpuPassTimers(const GpuPassTimers&) = delete;
+    GpuPassTimers& operator=(const GpuPassTimers&) = delete;
+
+    bool create();
+    void destroy();
+
+    [[nodiscard]] bool is_valid() const noexcept { return m_valid; }
+
+    // Rotate to the next query set and harvest the results the GPU
+    // finished FRAMES_IN_FLIGHT frames ago
+    void begin_frame();
+
+    // Open/close a GL_TIME_ELAPSED scope for the given pass index
+    void begin_pass(std::uint32_t pass);
+    void end_pass();
+
+    // Smoothed GPU milliseconds for a pass (0 when it did not run)
+    [[nodiscard]] float pass_ms(std::uint32_t pass) const noexcept {
+        return pass < MAX_PASSES ? m_results_ms[pass] : 0.0f;
+    }
+
+private:
+    std::array<std::array<std::uint32_t, MAX_PASSES>, FRAMES_IN_FLIGHT> m_queries{};
+    std::array<std::array<bool, MAX_PASSES>, FRAMES_IN_FLIGHT> m_issued{};
+    std::array<float, MAX_PASSES> m_results_ms{};
+    std::uint32_t m_frame = 0;
+    std::uint32_t m_active_pass = MAX_PASSES;  // MAX_PASSES = no open scope
+    bool m_valid = false;
+};
+
+// =============================================================================
+// FREE-LIST ARENA
+// Sub-allocates element ranges out of one large GPU buffer. First-fit
+// over an offset-sorted free list; released ranges merge with adjacent
+// neighbors so chunk mesh replacement does not fragment the pool.
+// =============================================================================
+class FreeListArena {
+public:
+    static constexpr std::uint32_t INVALID_OFFSET = 0xFFFFFFFFu;
+
+    // Reset the arena to a single free range of the given capacity
+    void reset(std::uint32_t capacity);
+
+    // Allocate a contiguous range; returns INVALID_OFFSET when full
+    [[nodiscard]] std::uint32_t allocate(std::uint32_t count);
+
+    // Return a previously allocated range to the free list
+    void release(std::uint32_t offset, std::uint32_t count);
+
+    [[nodiscard]] std::uint32_t capacity() const noexcept { return m_capacity; }
+    [[nodiscard]] std::uint32_t used() const noexcept { return m_used; }
+
+private:
+    struct FreeRange {
+        std::uint32_t offset;
+        std::uint32_t count;
+    };
+
+    std::vector<FreeRange> m_free;  // Sorted by offset
+    std::uint32_t m_capacity = 0;
+    std::uint32_t m_used = 0;
+};
+
 // =============================================================================
 // CHUNK GPU DATA
+// Ranges into the pooled vertex/index arenas (element offsets, not bytes)
 // =============================================================================
 struct ChunkGPUData {
-    std::uint32_t vao = 0;
-    std::uint32_t vbo = 0;
-    std::uint32_t ebo = 0;
-
+    std::uint32_t vertex_offset = 0;
     std::uint32_t vertex_count = 0;
+    std::uint32_t index_offset = 0;
     std::uint32_t index_count = 0;
 
+    // Translucent sub-mesh ranges in the same arenas (counts are 0 for
+    // the common chunk with no translucent geometry)
+    std::uint32_t translucent_vertex_offset = 0;
+    std::uint32_t translucent_vertex_count = 0;
+    std::uint32_t translucent_index_offset = 0;
+    std::uint32_t translucent_index_count = 0;
+
     ChunkPosition position;
     bool valid = false;
 };
@@ -73,8 +209,14 @@ struct ChunkGPUData {
 // DRAW COMMAND BATCH
 // =============================================================================
 struct DrawBatch {
-    std::vector<DrawElementsIndirectCommand> commands;
-    std::vector<math::Vec3> chunk_offsets;  // For uniform buffer
+    std::vector<DrawElementsIndirectCommand> commands;  // Opaque, sorted front-to-back
+    std::vector<math::Vec3> chunk_offsets;  // For uniform buffer (shared by both lists)
+    std::vector<float> bounds;              // Two vec4 per opaque command (AABB min/max) for GPU culling
+
+    // Translucent draws, sorted back-to-front and issued blended after
+    // every opaque command; not occlusion-culled (they write no depth,
+    // and zeroing them against last frame's pyramid would pop)
+    std::vector<DrawElementsIndirectCommand> translucent_commands;
 };
 
 // =============================================================================
@@ -147,6 +289,11 @@ public:
     // Render single chunk (debug)
     void render_chunk(const ChunkPosition& pos);
 
+    // Enable/disable the Hi-Z occlusion pass (on by default; falls back
+    // to frustum-only culling when the compute shaders are unavailable)
+    void set_occlusion_culling(bool enabled) noexcept { m_occlusion_enabled = enabled; }
+    [[nodiscard]] bool occlusion_culling_enabled() const noexcept { return m_occlusion_enabled; }
+
     // =============================================================================
     // STATISTICS
     // =============================================================================
@@ -156,6 +303,31 @@ public:
     [[nodiscard]] std::size_t total_indices() const noexcept { return m_total_indices; }
     [[nodiscard]] std::size_t draw_calls_last_frame() const noexcept { return m_draw_calls; }
     [[nodiscard]] std::size_t meshes_rebuilt_last_frame() const noexcept { return m_meshes_rebuilt; }
+    [[nodiscard]] std::size_t chunks_culled_last_frame() const noexcept { return m_chunks_culled; }
+
+    // GPU time per render pass, measured with multi-buffered
+    // GL_TIME_ELAPSED queries (values lag the CPU by a few frames)
+    enum class GpuPass : std::uint32_t {
+        CHUNKS = 0,        // Indirect multi-draw of visible chunks
+        OCCLUSION,         // Hi-Z AABB cull compute dispatch
+        DEPTH_PYRAMID,     // Depth copy + pyramid downsample
+        HIGHLIGHT,         // Block highlight wireframe
+        COUNT
+    };
+
+    [[nodiscard]] float gpu_pass_ms(GpuPass pass) const noexcept {
+        return m_gpu_timers.pass_ms(static_cast<std::uint32_t>(pass));
+    }
+
+    [[nodiscard]] static const char* gpu_pass_name(GpuPass pass) noexcept {
+        switch (pass) {
+            case GpuPass::CHUNKS:        return "chunks";
+            case GpuPass::OCCLUSION:     return "occlusion";
+            case GpuPass::DEPTH_PYRAMID: return "depth pyramid";
+            case GpuPass::HIGHLIGHT:     return "highlight";
+            default:                     return "?";
+        }
+    }
 
     // =============================================================================
     // DEBUG / VISUALIZATION
@@ -167,13 +339,20 @@ public:
     void set_cull_face(bool enabled);
 
 private:
-    bool create_chunk_vao(ChunkGPUData& gpu_data, const ChunkMesh& mesh);
+    bool create_arena_resources();
+    void upload_chunk_ranges(const ChunkGPUData& gpu_data, const ChunkMesh& mesh);
     void destroy_chunk_data(ChunkGPUData& data);
     bool create_highlight_resources();
 
     // Build indirect draw commands for visible chunks
     void build_draw_batch(DrawBatch& batch, const math::Vec3& camera_pos);
 
+    // Hi-Z occlusion pass
+    bool create_occlusion_resources();
+    void ensure_depth_pyramid(std::int32_t width, std::int32_t height);
+    void capture_depth_pyramid();
+    void dispatch_occlusion_cull(const DrawBatch& batch);
+
 private:
     bool m_initialized = false;
 
@@ -194,15 +373,79 @@ private:
     // Chunk meshes on GPU
     std::unordered_map<ChunkPosition, ChunkGPUData> m_chunks;
 
+    // Coarse culling hierarchy: chunks grouped into 4x4x4 super-cells.
+    // A cell fully outside the frustum rejects 64 chunks with one test;
+    // a cell fully inside accepts them without per-chunk tests.
+    static constexpr ChunkCoord SUPER_CELL_SHIFT = 2;
+    std::unordered_map<ChunkPosition, std::vector<ChunkPosition>> m_super_cells;
+
+    // View frustum for the current frame (extracted in set_camera)
+    Frustum m_frustum;
+
+    // Hi-Z occlusion culling: last frame's depth is copied into a max
+    // depth pyramid; a compute pass tests per-draw AABBs against it and
+    // zeroes instance_count of hidden draws before the indirect draw
+    bool m_occlusion_enabled = true;
+    bool m_occlusion_supported = false;
+    bool m_pyramid_valid = false;
+
+    Shader m_hiz_shader;      // Pyramid downsample compute
+    Shader m_cull_shader;     // AABB vs pyramid compute
+
+    std::uint32_t m_scene_depth = 0;     // Depth copy of the framebuffer
+    std::uint32_t m_depth_pyramid = 0;   // R32F max-depth mip chain
+    std::int32_t m_pyramid_width = 0;
+    std::int32_t m_pyramid_height = 0;
+    std::int32_t m_pyramid_mips = 0;
+
+    std::uint32_t m_bounds_buffer = 0;   // Per-draw AABBs for the cull pass
+
+    // Pooled mesh arena: one vertex buffer, one index buffer, one VAO.
+    // Chunk meshes are sub-allocated ranges; one glMultiDrawElementsIndirect
+    // draws every visible chunk
+    static constexpr std::uint32_t VERTEX_POOL_CAPACITY = 8u * 1024u * 1024u;   // 64 MiB of PackedVertex
+    static constexpr std::uint32_t INDEX_POOL_CAPACITY = 12u * 1024u * 1024u;   // 48 MiB of uint32
+
+    std::uint32_t m_arena_vao = 0;
+    std::uint32_t m_vertex_pool = 0;
+    std::uint32_t m_index_pool = 0;
+    std::uint32_t m_offset_buffer = 0;  // Per-draw chunk offsets (instanced attribute)
+
+    FreeListArena m_vertex_arena;
+    FreeListArena m_index_arena;
+
+    // Staging ring for mesh uploads (memcpy + GPU-side copy instead of
+    // synchronous glNamedBufferSubData). Sized for a heavy frame of
+    // remeshes; overflow falls back to the direct path.
+    static constexpr std::size_t STAGING_REGION_BYTES = 8u * 1024u * 1024u;
+    StagingRing m_staging;
+
+    // Per-pass GPU timing for the debug overlay
+    GpuPassTimers m_gpu_timers;
+
     // Indirect draw buffer
     PersistentBuffer m_indirect_buffer;
     static constexpr std::size_t MAX_DRAW_COMMANDS = 4096;
 
+    // Per-frame command list (reused to avoid reallocation)
+    DrawBatch m_draw_batch;
+
+    // Per-frame scratch: frustum survivors with camera distance, sorted
+    // before commands are emitted (opaque near-first for early-z,
+    // translucent far-first for correct blending)
+    struct VisibleChunk {
+        const ChunkGPUData* data;
+        float distance_sq;
+    };
+    std::vector<VisibleChunk> m_visible_opaque;
+    std::vector<VisibleChunk> m_visible_translucent;
+
     // Statistics
     std::size_t m_total_vertices = 0;
     std::size_t m_total_indices = 0;
     std::size_t m_draw_calls = 0;
     std::size_t m_meshes_rebuilt = 0;
+    std::size_t m_chunks_culled = 0;
 
     // Default texture (1x1 white)
     std::uint32_t m_default_texture = 0;
@@ -37,6 +37,9 @@ public:
     // Compile from file paths
     bool compile_from_files(const std::string& vertex_path, const std::string& fragment_path);
 
+    // Compile a compute program
+    bool compile_compute(std::string_view compute_source);
+
     // Get compilation error
     [[nodiscard]] const std::string& error() const noexcept { return m_error; }
 
@@ -75,6 +78,15 @@ private:
     std::uint32_t compile_shader(std::uint32_t type, std::string_view source);
     void destroy();
 
+    // Program binary cache: linked binaries are saved to disk keyed by a
+    // hash of the sources plus the driver strings, so later startups load
+    // with glProgramBinary instead of recompiling GLSL. A key or driver
+    // mismatch silently falls back to a full compile.
+    [[nodiscard]] static std::uint64_t cache_key(std::string_view vertex_source,
+                                                 std::string_view fragment_source);
+    [[nodiscard]] bool load_cached_binary(std::uint64_t key);
+    void store_cached_binary(std::uint64_t key) const;
+
 private:
     std::uint32_t m_program = 0;
     std::unordered_map<std::string, std::int32_t> m_uniform_cache;
@@ -96,9 +108,11 @@ constexpr const char* CHUNK_VERTEX_SHADER = R"glsl(
 layout(location = 0) in uint data1;
 layout(location = 1) in uint data2;
 
-// Per-chunk uniforms
+// Per-draw chunk offset (instanced attribute, divisor 1; each indirect
+// command selects its slot via base_instance)
+layout(location = 2) in vec3 a_ChunkOffset;  // Chunk position relative to render origin
+
 layout(location = 0) uniform mat4 u_ViewProjection;
-layout(location = 1) uniform vec3 u_ChunkOffset;  // Chunk position relative to render origin
 
 // Outputs to fragment shader
 out vec3 v_Position;
@@ -158,7 +172,7 @@ void main() {
     }
     // Level 8 or 0: no offset (full block)
     
-    vec3 worldPos = localPos + u_ChunkOffset;
+    vec3 worldPos = localPos + a_ChunkOffset;
 
     // Transform to clip space
     gl_Position = u_ViewProjection * vec4(worldPos, 1.0);
@@ -291,6 +305,139 @@ void main() {
 }
 )glsl";
 
+// Hi-Z depth pyramid downsample
+// Level 0 copies the captured scene depth 1:1 (u_SrcLod == -1); every
+// further level takes the max of the 2x2 source texels, so each texel
+// conservatively holds the farthest depth of the area it covers
+constexpr const char* HIZ_DOWNSAMPLE_COMPUTE = R"glsl(
+#version 450 core
+
+layout(local_size_x = 8, local_size_y = 8) in;
+
+layout(r32f, binding = 0) uniform writeonly image2D u_DstMip;
+layout(binding = 0) uniform sampler2D u_SrcTexture;
+
+uniform int u_SrcLod;     // -1: copy pass from scene depth
+uniform int u_DstWidth;
+uniform int u_DstHeight;
+
+void main() {
+    ivec2 pix = ivec2(gl_GlobalInvocationID.xy);
+    if (pix.x >= u_DstWidth || pix.y >= u_DstHeight) {
+        return;
+    }
+
+    float depth;
+    if (u_SrcLod < 0) {
+        depth = texelFetch(u_SrcTexture, pix, 0).r;
+    } else {
+        ivec2 srcSize = max(textureSize(u_SrcTexture, u_SrcLod), ivec2(1));
+        ivec2 base = pix * 2;
+        ivec2 c0 = min(base,               srcSize - 1);
+        ivec2 c1 = min(base + ivec2(1, 0), srcSize - 1);
+        ivec2 c2 = min(base + ivec2(0, 1), srcSize - 1);
+        ivec2 c3 = min(base + ivec2(1, 1), srcSize - 1);
+        depth = max(
+            max(texelFetch(u_SrcTexture, c0, u_SrcLod).r,
+                texelFetch(u_SrcTexture, c1, u_SrcLod).r),
+            max(texelFetch(u_SrcTexture, c2, u_SrcLod).r,
+                texelFetch(u_SrcTexture, c3, u_SrcLod).r));
+    }
+
+    imageStore(u_DstMip, pix, vec4(depth));
+}
+)glsl";
+
+// Occlusion culling against the Hi-Z pyramid
+// Projects each draw's AABB to a screen rect, picks the mip where the
+// rect covers ~2x2 texels, and zeroes instance_count when the nearest
+// AABB depth is behind the farthest pyramid depth. The indirect draw
+// then executes no work for hidden chunks - no CPU readback anywhere
+constexpr const char* OCCLUSION_CULL_COMPUTE = R"glsl(
+#version 450 core
+
+layout(local_size_x = 64) in;
+
+struct DrawCommand {
+    uint count;
+    uint instance_count;
+    uint first_index;
+    uint base_vertex;
+    uint base_instance;
+};
+
+layout(std430, binding = 0) buffer CommandBuffer {
+    DrawCommand commands[];
+};
+
+// Two vec4 per draw: [min.xyz, pad], [max.xyz, pad]
+layout(std430, binding = 1) readonly buffer BoundsBuffer {
+    vec4 bounds[];
+};
+
+layout(binding = 0) uniform sampler2D u_DepthPyramid;
+
+uniform mat4 u_ViewProjection;
+uniform uint u_CommandCount;
+uniform int u_PyramidWidth;
+uniform int u_PyramidHeight;
+uniform int u_MipCount;
+
+void main() {
+    uint draw = gl_GlobalInvocationID.x;
+    if (draw >= u_CommandCount) {
+        return;
+    }
+
+    vec3 bmin = bounds[draw * 2u + 0u].xyz;
+    vec3 bmax = bounds[draw * 2u + 1u].xyz;
+
+    // Project the 8 AABB corners; any corner behind the near plane makes
+    // the chunk conservatively visible
+    vec2 ndcMin = vec2(1.0);
+    vec2 ndcMax = vec2(-1.0);
+    float nearestDepth = 1.0;
+
+    for (int corner = 0; corner < 8; ++corner) {
+        vec3 p = vec3(
+            (corner & 1) != 0 ? bmax.x : bmin.x,
+            (corner & 2) != 0 ? bmax.y : bmin.y,
+            (corner & 4) != 0 ? bmax.z : bmin.z);
+        vec4 clip = u_ViewProjection * vec4(p, 1.0);
+        if (clip.w <= 0.0) {
+            return;
+        }
+        vec3 ndc = clip.xyz / clip.w;
+        ndcMin = min(ndcMin, ndc.xy);
+        ndcMax = max(ndcMax, ndc.xy);
+        nearestDepth = min(nearestDepth, ndc.z);
+    }
+
+    vec2 uvMin = clamp(ndcMin * 0.5 + 0.5, 0.0, 1.0);
+    vec2 uvMax = clamp(ndcMax * 0.5 + 0.5, 0.0, 1.0);
+    float chunkDepth = clamp(nearestDepth * 0.5 + 0.5, 0.0, 1.0);
+
+    // Mip where the screen rect covers at most ~2x2 texels
+    vec2 sizePx = (uvMax - uvMin) * vec2(float(u_PyramidWidth), float(u_PyramidHeight));
+    float maxExtent = max(max(sizePx.x, sizePx.y), 1.0);
+    int lod = clamp(int(ceil(log2(maxExtent))), 0, u_MipCount - 1);
+
+    ivec2 lodSize = max(ivec2(u_PyramidWidth >> lod, u_PyramidHeight >> lod), ivec2(1));
+    ivec2 t0 = clamp(ivec2(uvMin * vec2(lodSize)), ivec2(0), lodSize - 1);
+    ivec2 t1 = clamp(ivec2(uvMax * vec2(lodSize)), ivec2(0), lodSize - 1);
+
+    float farthest = max(
+        max(texelFetch(u_DepthPyramid, ivec2(t0.x, t0.y), lod).r,
+            texelFetch(u_DepthPyramid, ivec2(t1.x, t0.y), lod).r),
+        max(texelFetch(u_DepthPyramid, ivec2(t0.x, t1.y), lod).r,
+            texelFetch(u_DepthPyramid, ivec2(t1.x, t1.y), lod).r));
+
+    if (chunkDepth > farthest) {
+        commands[draw].instance_count = 0u;
+    }
+}
+)glsl";
+
 } // namespace shaders
 
 } // namespace voxel::client
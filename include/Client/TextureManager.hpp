@@ -2,13 +2,21 @@
 // VOXEL ENGINE - TEXTURE MANAGER
 // GL_TEXTURE_2D_ARRAY based texture atlas for efficient block rendering
 // Supports mipmap generation and GL_REPEAT for greedy meshing
+// PNG decode runs in parallel on the shared thread pool, decoded pixels
+// are cached on disk so later startups skip stb_image entirely, and the
+// upload goes through a pixel buffer object so the GL thread hands the
+// driver a DMA source instead of copying client memory
 // =============================================================================
 #pragma once
 
+#include "Shared/ThreadPool.hpp"
+
 #include <algorithm>
 #include <cstdint>
 #include <cstdio>
 #include <cstring>
+#include <fstream>
+#include <future>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -31,6 +39,12 @@ class TextureManager {
 public:
     static constexpr std::uint32_t TEXTURE_SIZE = 16;      // Each texture is 16x16
     static constexpr std::uint32_t MAX_LAYERS = 256;       // Max texture layers
+    static constexpr std::size_t LAYER_BYTES = TEXTURE_SIZE * TEXTURE_SIZE * 4;
+
+    // Decoded-pixel cache written next to the PNGs on first run
+    static constexpr const char* CACHE_FILENAME = "textures.cache";
+    static constexpr std::uint32_t CACHE_MAGIC = 0x43545856;  // 'VXTC'
+    static constexpr std::uint32_t CACHE_VERSION = 1;
     
     TextureManager() = default;
     ~TextureManager() { destroy(); }
@@ -71,10 +85,25 @@ public:
         // Sort for consistent ordering
         std::sort(png_files.begin(), png_files.end());
         
-        std::printf("[TextureManager] Found %zu textures in %s\n", 
+        std::printf("[TextureManager] Found %zu textures in %s\n",
                     png_files.size(), directory_path.c_str());
-        
-        return create_texture_array(png_files);
+
+        const std::uint32_t num_layers = static_cast<std::uint32_t>(
+            std::min(png_files.size(), static_cast<std::size_t>(MAX_LAYERS)));
+
+        // Decoded pixels for every layer, contiguous so the whole array
+        // uploads with one PBO-backed glTextureSubImage3D
+        std::vector<std::uint8_t> pixels(static_cast<std::size_t>(num_layers) * LAYER_BYTES);
+
+        const fs::path cache_path = fs::path(directory_path) / CACHE_FILENAME;
+        if (load_pixel_cache(cache_path, png_files, num_layers, pixels)) {
+            std::printf("[TextureManager] Loaded %u layers from pixel cache\n", num_layers);
+        } else {
+            decode_parallel(png_files, num_layers, pixels);
+            write_pixel_cache(cache_path, png_files, num_layers, pixels);
+        }
+
+        return create_texture_array(png_files, num_layers, pixels);
     }
     
     // ==========================================================================
@@ -135,13 +164,148 @@ private:
         m_name_to_layer.clear();
     }
     
-    bool create_texture_array(const std::vector<std::string>& png_files) {
+    // ==========================================================================
+    // PARALLEL DECODE
+    // One decode task per PNG on the shared pool; each writes its layer's
+    // pixels in place. Failed or wrong-size files fall back to white.
+    // ==========================================================================
+    void decode_parallel(const std::vector<std::string>& png_files,
+                         std::uint32_t num_layers,
+                         std::vector<std::uint8_t>& pixels) {
+        std::vector<std::future<void>> tasks;
+        tasks.reserve(num_layers);
+
+        for (std::uint32_t layer = 0; layer < num_layers; ++layer) {
+            std::uint8_t* dest = pixels.data() + static_cast<std::size_t>(layer) * LAYER_BYTES;
+            const std::string& filepath = png_files[layer];
+
+            tasks.push_back(global_thread_pool().submit([filepath, dest] {
+                int width = 0, height = 0, channels = 0;
+                unsigned char* decoded =
+                    stbi_load(filepath.c_str(), &width, &height, &channels, 4);
+
+                if (decoded && width == static_cast<int>(TEXTURE_SIZE) &&
+                    height == static_cast<int>(TEXTURE_SIZE)) {
+                    std::memcpy(dest, decoded, LAYER_BYTES);
+                } else {
+                    std::memset(dest, 255, LAYER_BYTES);  // Opaque white fallback
+                    if (decoded) {
+                        std::printf("[TextureManager] Wrong size for %s (%dx%d, expected %ux%u)\n",
+                                    filepath.c_str(), width, height, TEXTURE_SIZE, TEXTURE_SIZE);
+                    } else {
+                        std::printf("[TextureManager] Failed to load: %s\n", filepath.c_str());
+                    }
+                }
+
+                if (decoded) {
+                    stbi_image_free(decoded);
+                }
+            }));
+        }
+
+        for (auto& task : tasks) {
+            task.get();
+        }
+    }
+
+    // ==========================================================================
+    // PIXEL CACHE
+    // Decoded RGBA for every layer in one file, written on first run.
+    // Valid only while the PNG set is unchanged and no PNG is newer than
+    // the cache; any mismatch falls back to a full decode + rewrite.
+    // ==========================================================================
+    bool load_pixel_cache(const std::filesystem::path& cache_path,
+                          const std::vector<std::string>& png_files,
+                          std::uint32_t num_layers,
+                          std::vector<std::uint8_t>& pixels) {
         namespace fs = std::filesystem;
-        
-        std::uint32_t num_layers = static_cast<std::uint32_t>(
-            std::min(png_files.size(), static_cast<std::size_t>(MAX_LAYERS))
-        );
-        
+
+        std::error_code ec;
+        if (!fs::exists(cache_path, ec)) {
+            return false;
+        }
+
+        const auto cache_time = fs::last_write_time(cache_path, ec);
+        if (ec) {
+            return false;
+        }
+        for (std::uint32_t layer = 0; layer < num_layers; ++layer) {
+            const auto png_time = fs::last_write_time(png_files[layer], ec);
+            if (ec || png_time > cache_time) {
+                return false;  // Source texture changed since the cache was built
+            }
+        }
+
+        std::ifstream file(cache_path, std::ios::binary);
+        if (!file.is_open()) {
+            return false;
+        }
+
+        std::uint32_t magic = 0, version = 0, size = 0, count = 0;
+        file.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+        file.read(reinterpret_cast<char*>(&version), sizeof(version));
+        file.read(reinterpret_cast<char*>(&size), sizeof(size));
+        file.read(reinterpret_cast<char*>(&count), sizeof(count));
+        if (!file || magic != CACHE_MAGIC || version != CACHE_VERSION ||
+            size != TEXTURE_SIZE || count != num_layers) {
+            return false;
+        }
+
+        // The name list must match the current sorted PNG set exactly,
+        // otherwise layer indices would silently shift
+        for (std::uint32_t layer = 0; layer < num_layers; ++layer) {
+            std::uint16_t name_len = 0;
+            file.read(reinterpret_cast<char*>(&name_len), sizeof(name_len));
+            std::string name(name_len, '\0');
+            file.read(name.data(), name_len);
+            if (!file || name != fs::path(png_files[layer]).filename().string()) {
+                return false;
+            }
+        }
+
+        file.read(reinterpret_cast<char*>(pixels.data()),
+                  static_cast<std::streamsize>(pixels.size()));
+        return static_cast<bool>(file);
+    }
+
+    void write_pixel_cache(const std::filesystem::path& cache_path,
+                           const std::vector<std::string>& png_files,
+                           std::uint32_t num_layers,
+                           const std::vector<std::uint8_t>& pixels) {
+        namespace fs = std::filesystem;
+
+        std::ofstream file(cache_path, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            std::printf("[TextureManager] Could not write pixel cache: %s\n",
+                        cache_path.string().c_str());
+            return;
+        }
+
+        const std::uint32_t magic = CACHE_MAGIC;
+        const std::uint32_t version = CACHE_VERSION;
+        const std::uint32_t size = TEXTURE_SIZE;
+        file.write(reinterpret_cast<const char*>(&magic), sizeof(magic));
+        file.write(reinterpret_cast<const char*>(&version), sizeof(version));
+        file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+        file.write(reinterpret_cast<const char*>(&num_layers), sizeof(num_layers));
+
+        for (std::uint32_t layer = 0; layer < num_layers; ++layer) {
+            const std::string name = fs::path(png_files[layer]).filename().string();
+            const std::uint16_t name_len = static_cast<std::uint16_t>(name.size());
+            file.write(reinterpret_cast<const char*>(&name_len), sizeof(name_len));
+            file.write(name.data(), name_len);
+        }
+
+        file.write(reinterpret_cast<const char*>(pixels.data()),
+                   static_cast<std::streamsize>(pixels.size()));
+        std::printf("[TextureManager] Wrote pixel cache (%zu bytes)\n", pixels.size());
+    }
+
+    bool create_texture_array(const std::vector<std::string>& png_files,
+                              std::uint32_t num_layers,
+                              const std::vector<std::uint8_t>& pixels) {
+        namespace fs = std::filesystem;
+
         // Calculate mipmap levels (log2 of texture size)
         std::uint32_t mip_levels = 1;
         std::uint32_t size = TEXTURE_SIZE;
@@ -149,62 +313,52 @@ private:
             size >>= 1;
             mip_levels++;
         }
-        
+
         // Create texture array using DSA
         glCreateTextures(GL_TEXTURE_2D_ARRAY, 1, &m_texture_array);
-        
+
         // Allocate storage for all layers with mipmaps
-        glTextureStorage3D(m_texture_array, 
+        glTextureStorage3D(m_texture_array,
                            static_cast<GLsizei>(mip_levels),
-                           GL_RGBA8, 
-                           static_cast<GLsizei>(TEXTURE_SIZE), 
-                           static_cast<GLsizei>(TEXTURE_SIZE), 
+                           GL_RGBA8,
+                           static_cast<GLsizei>(TEXTURE_SIZE),
+                           static_cast<GLsizei>(TEXTURE_SIZE),
                            static_cast<GLsizei>(num_layers));
-        
-        // Load each texture into a layer
-        std::vector<std::uint8_t> default_pixels(TEXTURE_SIZE * TEXTURE_SIZE * 4, 255);
-        
+
+        // Upload every layer in one call through a pixel buffer object:
+        // with a PBO bound the pixel pointer is a buffer offset and the
+        // driver DMAs from GPU-visible memory instead of blocking on a
+        // client-memory copy
+        std::uint32_t pbo = 0;
+        glCreateBuffers(1, &pbo);
+        if (pbo != 0) {
+            glNamedBufferStorage(pbo, static_cast<GLsizeiptr>(pixels.size()),
+                                 pixels.data(), 0);
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo);
+            glTextureSubImage3D(m_texture_array, 0,
+                                0, 0, 0,
+                                static_cast<GLsizei>(TEXTURE_SIZE),
+                                static_cast<GLsizei>(TEXTURE_SIZE),
+                                static_cast<GLsizei>(num_layers),
+                                GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+            glDeleteBuffers(1, &pbo);
+        } else {
+            glTextureSubImage3D(m_texture_array, 0,
+                                0, 0, 0,
+                                static_cast<GLsizei>(TEXTURE_SIZE),
+                                static_cast<GLsizei>(TEXTURE_SIZE),
+                                static_cast<GLsizei>(num_layers),
+                                GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+        }
+
         for (std::uint32_t layer = 0; layer < num_layers; ++layer) {
-            const std::string& filepath = png_files[layer];
-            std::string filename = fs::path(filepath).filename().string();
-            
-            int width, height, channels;
-            unsigned char* pixels = stbi_load(filepath.c_str(), &width, &height, &channels, 4);
-            
-            if (pixels && width == static_cast<int>(TEXTURE_SIZE) && 
-                height == static_cast<int>(TEXTURE_SIZE)) {
-                glTextureSubImage3D(m_texture_array, 0,
-                                   0, 0, static_cast<GLint>(layer),
-                                   static_cast<GLsizei>(TEXTURE_SIZE), 
-                                   static_cast<GLsizei>(TEXTURE_SIZE), 1,
-                                   GL_RGBA, GL_UNSIGNED_BYTE, pixels);
-                
-                m_name_to_layer[filename] = layer;
-                std::printf("[TextureManager] Loaded: %s -> layer %u\n", filename.c_str(), layer);
-            } else {
-                // Use default white if load failed or wrong size
-                glTextureSubImage3D(m_texture_array, 0,
-                                   0, 0, static_cast<GLint>(layer),
-                                   static_cast<GLsizei>(TEXTURE_SIZE), 
-                                   static_cast<GLsizei>(TEXTURE_SIZE), 1,
-                                   GL_RGBA, GL_UNSIGNED_BYTE, default_pixels.data());
-                
-                if (pixels) {
-                    std::printf("[TextureManager] Wrong size for %s (%dx%d, expected %ux%u)\n",
-                               filename.c_str(), width, height, TEXTURE_SIZE, TEXTURE_SIZE);
-                } else {
-                    std::printf("[TextureManager] Failed to load: %s\n", filename.c_str());
-                }
-                m_name_to_layer[filename] = layer;
-            }
-            
-            if (pixels) {
-                stbi_image_free(pixels);
-            }
+            std::string filename = fs::path(png_files[layer]).filename().string();
+            m_name_to_layer[filename] = layer;
         }
-        
+
         m_layer_count = num_layers;
-        
+
         // Generate mipmaps
         glGenerateTextureMipmap(m_texture_array);
         
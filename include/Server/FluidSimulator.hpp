@@ -7,10 +7,14 @@
 
 #include "Shared/Types.hpp"
 #include "Shared/BlockRegistry.hpp"
+#include "Shared/ThreadPool.hpp"
 #include "Server/World.hpp"
 
 #include <vector>
 #include <queue>
+#include <future>
+#include <memory>
+#include <unordered_map>
 #include <unordered_set>
 #include <mutex>
 
@@ -31,24 +35,30 @@ struct FluidUpdate {
 // =============================================================================
 class FluidSimulator {
 public:
-    static constexpr int FLUID_UPDATE_INTERVAL = 5;  // Ticks between fluid updates (4 TPS)
-    
-    explicit FluidSimulator(World& world) 
-        : m_world(world), m_tick_counter(0) {}
+    // Ticks between fluid updates (4 TPS at the 20 TPS base rate).
+    // The interval lives in the TickManager system registration now;
+    // this constant is what callers register with.
+    static constexpr std::uint32_t FLUID_UPDATE_INTERVAL = 5;
+
+    // Below this many active chunks the serial path is cheaper than
+    // snapshotting and dispatching to the pool
+    static constexpr std::size_t PARALLEL_CHUNK_THRESHOLD = 4;
+
+    explicit FluidSimulator(World& world)
+        : m_world(world) {}
+
+    // Enable/disable stepping active chunks on the shared thread pool
+    // (on by default; the serial path remains for small update sets)
+    void set_parallel(bool enabled) noexcept { m_parallel = enabled; }
+    [[nodiscard]] bool parallel_enabled() const noexcept { return m_parallel; }
     
     // =============================================================================
     // MAIN UPDATE (Called from TickManager)
     // =============================================================================
+    // One fluid step. Interval pacing is the scheduler's job: register
+    // this with TickManager at FLUID_UPDATE_INTERVAL instead of calling
+    // it every tick.
     void tick() {
-        m_tick_counter++;
-        
-        // Only update fluids every FLUID_UPDATE_INTERVAL ticks
-        if (m_tick_counter < FLUID_UPDATE_INTERVAL) {
-            return;
-        }
-        m_tick_counter = 0;
-        
-        // Process pending fluid updates
         process_updates();
     }
     
@@ -131,31 +141,247 @@ public:
     }
 
 private:
+    // =============================================================================
+    // TICK-SCOPED CHUNK CACHE
+    // Each touched chunk is resolved through the world lock once per
+    // fluid tick; all cell reads and writes during the tick go through
+    // the held Chunk* with local coordinates. Boundary flows resolve
+    // the neighbor chunk through the same cache, so crossing a chunk
+    // edge costs one extra lookup per neighbor chunk, not per cell.
+    // Dirty marking is batched and flushed once per chunk at tick end.
+    // =============================================================================
+    struct TickContext {
+        World& world;
+        std::unordered_map<ChunkPosition, Chunk*> chunks;
+        std::unordered_set<ChunkPosition> dirty;
+
+        // Resolve a chunk, hitting the world lock only on cache miss.
+        // Missing chunks cache as nullptr (reads see air).
+        [[nodiscard]] Chunk* find(ChunkPosition pos) {
+            auto it = chunks.find(pos);
+            if (it != chunks.end()) {
+                return it->second;
+            }
+            Chunk* chunk = world.get_chunk_mut(pos);
+            chunks.emplace(pos, chunk);
+            return chunk;
+        }
+
+        // Resolve a chunk for writing, loading it if not resident
+        // (fluids may flow into chunks at the edge of the loaded set)
+        [[nodiscard]] Chunk* ensure(ChunkPosition pos) {
+            Chunk* chunk = find(pos);
+            if (!chunk) {
+                chunk = world.load_chunk(pos);
+                chunks[pos] = chunk;
+            }
+            return chunk;
+        }
+
+        [[nodiscard]] Voxel get(ChunkCoord x, ChunkCoord y, ChunkCoord z) {
+            const Chunk* chunk = find(World::world_to_chunk_pos(x, y, z));
+            if (!chunk) {
+                return Voxel{};
+            }
+            return chunk->get(World::world_to_local(x),
+                              World::world_to_local(y),
+                              World::world_to_local(z));
+        }
+
+        bool set(ChunkCoord x, ChunkCoord y, ChunkCoord z, Voxel voxel) {
+            const ChunkPosition pos = World::world_to_chunk_pos(x, y, z);
+            Chunk* chunk = ensure(pos);
+            if (!chunk) {
+                return false;
+            }
+            const LocalCoord lx = World::world_to_local(x);
+            const LocalCoord ly = World::world_to_local(y);
+            const LocalCoord lz = World::world_to_local(z);
+
+            // Carry the stored light nibbles through the write (same
+            // convention as World::set_voxel - the lighting engine owns
+            // those channels)
+            constexpr std::uint32_t LIGHT_BITS =
+                Voxel::SUNLIGHT_MASK | Voxel::TORCHLIGHT_MASK;
+            const Voxel previous = chunk->get(lx, ly, lz);
+            voxel.data = (voxel.data & ~LIGHT_BITS) | (previous.data & LIGHT_BITS);
+
+            chunk->set(lx, ly, lz, voxel);
+
+            // Defer remesh notification to the end-of-tick flush; border
+            // writes mark the adjacent chunk too (cross-chunk face culling)
+            dirty.insert(pos);
+            if (lx == 0) {
+                dirty.insert(ChunkPosition{pos.x - 1, pos.y, pos.z});
+            } else if (lx == static_cast<LocalCoord>(CHUNK_SIZE_X - 1)) {
+                dirty.insert(ChunkPosition{pos.x + 1, pos.y, pos.z});
+            }
+            if (ly == 0) {
+                dirty.insert(ChunkPosition{pos.x, pos.y - 1, pos.z});
+            } else if (ly == static_cast<LocalCoord>(CHUNK_SIZE_Y - 1)) {
+                dirty.insert(ChunkPosition{pos.x, pos.y + 1, pos.z});
+            }
+            if (lz == 0) {
+                dirty.insert(ChunkPosition{pos.x, pos.y, pos.z - 1});
+            } else if (lz == static_cast<LocalCoord>(CHUNK_SIZE_Z - 1)) {
+                dirty.insert(ChunkPosition{pos.x, pos.y, pos.z + 1});
+            }
+            return true;
+        }
+    };
+
+    // =============================================================================
+    // DOUBLE-BUFFERED STEP VIEW
+    // Read side of the parallel mode: cells read tick-N state from
+    // immutable chunk snapshots while proposed writes buffer locally,
+    // so every active chunk can step on the pool without touching
+    // shared state. Writes apply serially at the sync point, which is
+    // also where cross-chunk boundary flows land in their real chunk.
+    // =============================================================================
+    struct PendingWrite {
+        ChunkCoord x, y, z;
+        Voxel voxel;
+    };
+
+    using SnapshotMap = std::unordered_map<ChunkPosition, std::shared_ptr<const Voxel[]>>;
+
+    struct StepView {
+        const SnapshotMap& snapshots;
+        std::vector<PendingWrite>& writes;
+
+        [[nodiscard]] Voxel get(ChunkCoord x, ChunkCoord y, ChunkCoord z) const {
+            const auto it = snapshots.find(World::world_to_chunk_pos(x, y, z));
+            if (it == snapshots.end() || !it->second) {
+                return Voxel{};
+            }
+            return it->second[coord::to_index(World::world_to_local(x),
+                                              World::world_to_local(y),
+                                              World::world_to_local(z))];
+        }
+
+        bool set(ChunkCoord x, ChunkCoord y, ChunkCoord z, Voxel voxel) {
+            writes.push_back(PendingWrite{x, y, z, voxel});
+            return true;
+        }
+    };
+
     void process_updates() {
         std::queue<FluidUpdate> to_process;
-        
+
         {
             std::lock_guard<std::mutex> lock(m_mutex);
             std::swap(to_process, m_pending);
         }
-        
+
+        // Group pending cells by owning chunk so each chunk's updates
+        // run back-to-back against the same cached Chunk*
+        std::unordered_map<ChunkPosition, std::vector<FluidUpdate>> buckets;
         std::unordered_set<std::size_t> processed;
-        
+
         while (!to_process.empty()) {
             FluidUpdate update = to_process.front();
             to_process.pop();
-            
+
             // Hash position to avoid duplicate processing
             std::size_t hash = position_hash(update.x, update.y, update.z);
             if (processed.count(hash) > 0) continue;
             processed.insert(hash);
-            
-            simulate_fluid(update);
+
+            buckets[World::world_to_chunk_pos(update.x, update.y, update.z)]
+                .push_back(update);
+        }
+
+        TickContext ctx{m_world, {}, {}};
+
+        if (m_parallel && buckets.size() >= PARALLEL_CHUNK_THRESHOLD) {
+            process_buckets_parallel(ctx, buckets);
+        } else {
+            for (const auto& [chunk_pos, updates] : buckets) {
+                for (const FluidUpdate& update : updates) {
+                    simulate_fluid(ctx, update);
+                }
+            }
+        }
+
+        // One remesh notification per touched chunk
+        for (const ChunkPosition& pos : ctx.dirty) {
+            m_world.mark_chunk_dirty(pos);
         }
     }
-    
-    void simulate_fluid(const FluidUpdate& update) {
-        Voxel current = m_world.get_voxel(update.x, update.y, update.z);
+
+    // Step every active chunk independently on the shared pool, then
+    // apply the buffered writes at the sync point (tick N reads, tick
+    // N+1 writes). Conflicting boundary writes resolve last-wins, the
+    // same arbitrary-order outcome the serial pass already had.
+    void process_buckets_parallel(
+        TickContext& ctx,
+        const std::unordered_map<ChunkPosition, std::vector<FluidUpdate>>& buckets
+    ) {
+        // Capture tick-N state: one snapshot per active chunk plus its
+        // face neighbors (cells only ever read one voxel outward).
+        // Unmodified chunks snapshot as a refcount bump.
+        SnapshotMap snapshots;
+        static constexpr std::array<std::array<ChunkCoord, 3>, 7> AREA = {{
+            {0, 0, 0},
+            {-1, 0, 0}, {1, 0, 0},
+            {0, -1, 0}, {0, 1, 0},
+            {0, 0, -1}, {0, 0, 1}
+        }};
+        for (const auto& [pos, updates] : buckets) {
+            for (const auto& off : AREA) {
+                const ChunkPosition p{pos.x + off[0], pos.y + off[1], pos.z + off[2]};
+                if (snapshots.count(p) > 0) {
+                    continue;
+                }
+                // Capture under the shard lock: snapshot() may rebuild
+                // the chunk's cached copy, which must not race with
+                // writers or any other snapshotter
+                snapshots.emplace(p, m_world.copy_chunk_snapshot(p));
+            }
+        }
+
+        // One task per active chunk; each buffers its writes locally
+        std::vector<std::vector<PendingWrite>> writes(buckets.size());
+        std::vector<std::future<void>> steps;
+        steps.reserve(buckets.size());
+
+        std::size_t slot = 0;
+        for (const auto& [pos, updates] : buckets) {
+            const std::vector<FluidUpdate>* cells = &updates;
+            std::vector<PendingWrite>* out = &writes[slot++];
+            steps.push_back(global_thread_pool().submit([this, &snapshots, cells, out]() {
+                StepView view{snapshots, *out};
+                for (const FluidUpdate& update : *cells) {
+                    simulate_fluid(view, update);
+                }
+            }));
+        }
+
+        for (auto& step : steps) {
+            step.get();
+        }
+
+        // Sync point: apply tick N+1 through the chunk cache
+        for (const auto& chunk_writes : writes) {
+            for (const PendingWrite& write : chunk_writes) {
+                ctx.set(write.x, write.y, write.z, write.voxel);
+            }
+        }
+    }
+
+    // Queue a cell for next tick without the world lookup the public
+    // path does - used for cells the simulation just wrote, which are
+    // known fluids
+    void schedule_internal(ChunkCoord x, ChunkCoord y, ChunkCoord z) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pending.push({x, y, z, 0, 0});
+    }
+
+    // Cells is TickContext (serial, in-place) or StepView (parallel,
+    // double-buffered) - both provide get/set in world coordinates
+    template <typename Cells>
+    void simulate_fluid(Cells& ctx, const FluidUpdate& update) {
+        Voxel current = ctx.get(update.x, update.y, update.z);
         
         // Skip if no longer a fluid
         if (!BlockRegistry::instance().is_fluid(current.type_id())) {
@@ -168,38 +394,40 @@ private:
         // === FLOWING WATER REMOVAL CHECK ===
         // If this is NOT a source block (level > 0), check if it should exist
         if (current_level > 0) {
-            if (!has_fluid_source_nearby(update.x, update.y, update.z, current.type_id())) {
+            if (!has_fluid_source_nearby(ctx, update.x, update.y, update.z, current.type_id())) {
                 // Remove flowing water that lost its source
-                m_world.set_voxel(update.x, update.y, update.z, Voxel(VoxelType::AIR));
+                ctx.set(update.x, update.y, update.z, Voxel(VoxelType::AIR));
                 
                 // Schedule updates for neighbors so they can also check
-                notify_block_change(update.x, update.y, update.z);
+                notify_neighbors(ctx, update.x, update.y, update.z);
                 return;
             }
         }
         
         // Check block below - flow down first (priority)
-        Voxel below = m_world.get_voxel(update.x, update.y - 1, update.z);
+        Voxel below = ctx.get(update.x, update.y - 1, update.z);
         if (can_flow_into(below)) {
             // Flow down - becomes source-like (level 0 for infinite flow down)
             Voxel new_fluid(current.type_id());
             new_fluid.set_metadata(0);  // Reset level when flowing down
-            m_world.set_voxel(update.x, update.y - 1, update.z, new_fluid);
+            ctx.set(update.x, update.y - 1, update.z, new_fluid);
             
             // Schedule the new fluid for update
-            schedule_update(update.x, update.y - 1, update.z);
+            schedule_internal(update.x, update.y - 1, update.z);
             return;
         }
         
         // If below is same fluid, still try horizontal spread
         // Only source blocks and blocks fed from above spread horizontally
         if (current_level < props.fluid_max_distance) {
-            spread_horizontal(update.x, update.y, update.z, current.type_id(), 
+            spread_horizontal(ctx, update.x, update.y, update.z, current.type_id(),
                             current_level, props.fluid_max_distance);
         }
     }
     
-    void spread_horizontal(ChunkCoord x, ChunkCoord y, ChunkCoord z, 
+    template <typename Cells>
+    void spread_horizontal(Cells& ctx,
+                          ChunkCoord x, ChunkCoord y, ChunkCoord z,
                           std::uint16_t fluid_id, std::uint8_t current_level,
                           std::uint8_t max_distance) {
         static constexpr std::array<std::array<ChunkCoord, 2>, 4> horizontal = {{
@@ -213,26 +441,47 @@ private:
             ChunkCoord nx = x + dir[0];
             ChunkCoord nz = z + dir[1];
             
-            Voxel neighbor = m_world.get_voxel(nx, y, nz);
+            Voxel neighbor = ctx.get(nx, y, nz);
             
             if (can_flow_into(neighbor)) {
                 // Place flowing water
                 Voxel new_fluid(fluid_id);
                 new_fluid.set_metadata(new_level);
-                m_world.set_voxel(nx, y, nz, new_fluid);
-                schedule_update(nx, y, nz);
+                ctx.set(nx, y, nz, new_fluid);
+                schedule_internal(nx, y, nz);
             } else if (neighbor.type_id() == fluid_id) {
                 // Existing fluid - check if we provide a shorter path
                 if (neighbor.metadata() > new_level && new_level > 0) {
                     Voxel updated_fluid(fluid_id);
                     updated_fluid.set_metadata(new_level);
-                    m_world.set_voxel(nx, y, nz, updated_fluid);
-                    schedule_update(nx, y, nz);
+                    ctx.set(nx, y, nz, updated_fluid);
+                    schedule_internal(nx, y, nz);
                 }
             }
         }
     }
     
+    // Re-queue fluid neighbors of a removed cell (cache-backed variant
+    // of notify_block_change for use inside the tick)
+    template <typename Cells>
+    void notify_neighbors(Cells& ctx, ChunkCoord x, ChunkCoord y, ChunkCoord z) {
+        static constexpr std::array<std::array<ChunkCoord, 3>, 6> offsets = {{
+            {-1, 0, 0}, {1, 0, 0},
+            {0, -1, 0}, {0, 1, 0},
+            {0, 0, -1}, {0, 0, 1}
+        }};
+
+        for (const auto& off : offsets) {
+            ChunkCoord nx = x + off[0];
+            ChunkCoord ny = y + off[1];
+            ChunkCoord nz = z + off[2];
+
+            if (BlockRegistry::instance().is_fluid(ctx.get(nx, ny, nz).type_id())) {
+                schedule_internal(nx, ny, nz);
+            }
+        }
+    }
+
     [[nodiscard]] bool can_flow_into(const Voxel& target) const {
         if (target.is_air()) return true;
         
@@ -240,16 +489,18 @@ private:
         return !props.is_solid && !props.is_fluid;
     }
     
-    [[nodiscard]] bool has_fluid_source_nearby(ChunkCoord x, ChunkCoord y, ChunkCoord z,
+    template <typename Cells>
+    [[nodiscard]] bool has_fluid_source_nearby(Cells& ctx,
+                                               ChunkCoord x, ChunkCoord y, ChunkCoord z,
                                                std::uint16_t fluid_id) const {
         // Check above (falling water is always fed)
-        Voxel above = m_world.get_voxel(x, y + 1, z);
+        Voxel above = ctx.get(x, y + 1, z);
         if (above.type_id() == fluid_id) {
             return true;
         }
         
         // Check horizontal neighbors for source or lower-level fluid
-        Voxel current = m_world.get_voxel(x, y, z);
+        Voxel current = ctx.get(x, y, z);
         std::uint8_t current_level = current.metadata();
         
         static constexpr std::array<std::array<ChunkCoord, 2>, 4> horizontal = {{
@@ -257,7 +508,7 @@ private:
         }};
         
         for (const auto& dir : horizontal) {
-            Voxel neighbor = m_world.get_voxel(x + dir[0], y, z + dir[1]);
+            Voxel neighbor = ctx.get(x + dir[0], y, z + dir[1]);
             if (neighbor.type_id() == fluid_id) {
                 // Source block (level 0) or block with lower level feeds us
                 if (neighbor.metadata() < current_level) {
@@ -282,7 +533,7 @@ private:
     World& m_world;
     std::queue<FluidUpdate> m_pending;
     std::mutex m_mutex;
-    int m_tick_counter;
+    bool m_parallel = true;
 };
 
 } // namespace voxel::server
@@ -135,6 +135,13 @@ private:
             return std::make_unique<SuperflatGenerator>(config);
         });
         
+        // Procedural fBm heightfield terrain
+        register_generator("noise_terrain", [](std::uint64_t seed) {
+            auto config = NoiseTerrainConfig::default_config();
+            config.seed = seed;
+            return std::make_unique<NoiseTerrainGenerator>(config);
+        });
+
         // Water world (for testing fluids)
         register_generator("water_world", [](std::uint64_t seed) {
             SuperflatConfig config;
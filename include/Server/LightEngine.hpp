@@ -0,0 +1,521 @@
+// =============================================================================
+// VOXEL ENGINE - LIGHT ENGINE
+// Incremental BFS flood-fill lighting over the sun/torch nibbles already
+// reserved in Voxel. Block edits queue bounded relight jobs the same way
+// FluidSimulator queues cell updates: a removal wave carries the pre-edit
+// level outward only along strictly darker chains, its frontier re-seeds
+// the propagation wave, and everything else in the chunk is untouched.
+// Skylight for a fresh chunk is seeded column-wise from the World
+// heightmap cache instead of a per-voxel scan.
+// =============================================================================
+#pragma once
+
+#include "Shared/Types.hpp"
+#include "Shared/BlockRegistry.hpp"
+#include "Server/World.hpp"
+
+#include <algorithm>
+#include <array>
+#include <queue>
+#include <unordered_map>
+#include <unordered_set>
+#include <mutex>
+#include <vector>
+
+namespace voxel::server {
+
+// =============================================================================
+// LIGHT ENGINE
+// Runs every simulation tick; the per-tick node budget keeps a worst-case
+// relight (large cave-in, emitter grid) from blowing the tick budget by
+// carrying the remaining wavefront into the next tick.
+// =============================================================================
+class LightEngine {
+public:
+    static constexpr std::uint8_t MAX_LIGHT = 15;
+
+    // Register with TickManager at this interval (every tick: light
+    // latency is visible, and an idle tick is two empty queue swaps)
+    static constexpr std::uint32_t LIGHT_UPDATE_INTERVAL = 1;
+
+    // BFS nodes processed per tick before the wavefront is re-queued
+    static constexpr std::size_t MAX_NODES_PER_TICK = 65536;
+
+    explicit LightEngine(World& world)
+        : m_world(world) {}
+
+    LightEngine(const LightEngine&) = delete;
+    LightEngine& operator=(const LightEngine&) = delete;
+
+    // =============================================================================
+    // MAIN UPDATE (Called from TickManager)
+    // =============================================================================
+    void tick() {
+        process_updates();
+    }
+
+    // =============================================================================
+    // BLOCK CHANGE NOTIFICATION
+    // Called after the world write (World::set_voxel preserves the light
+    // nibbles through block edits, so the stored levels a queued change
+    // sees at tick time are still the pre-edit values the removal wave
+    // needs)
+    // =============================================================================
+    void notify_block_change(ChunkCoord x, ChunkCoord y, ChunkCoord z) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pending_changes.push_back(LightNode{x, y, z});
+    }
+
+    // =============================================================================
+    // CHUNK INITIALIZATION
+    // Seed a newly loaded chunk: sunlight filled per column from the
+    // heightmap cache (one surface_height call per column instead of a
+    // downward voxel walk), emitters from the registry, and boundary
+    // light pulled in from whichever neighbor chunks are resident.
+    // =============================================================================
+    void initialize_chunk_light(ChunkPosition pos) {
+        Chunk* chunk = m_world.get_chunk_mut(pos);
+        if (!chunk) {
+            return;
+        }
+
+        const ChunkCoord base_x = coord::chunk_to_world(pos.x);
+        const ChunkCoord base_y = coord::chunk_to_world(pos.y);
+        const ChunkCoord base_z = coord::chunk_to_world(pos.z);
+        const ChunkCoord top_y = base_y + static_cast<ChunkCoord>(CHUNK_SIZE_Y) - 1;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        const auto& registry = BlockRegistry::instance();
+        for (LocalCoord lz = 0; lz < static_cast<LocalCoord>(CHUNK_SIZE_Z); ++lz) {
+            for (LocalCoord lx = 0; lx < static_cast<LocalCoord>(CHUNK_SIZE_X); ++lx) {
+                const ChunkCoord wx = base_x + lx;
+                const ChunkCoord wz = base_z + lz;
+
+                // Highest non-air voxel in the column; an all-air column
+                // is sky from top to bottom
+                const auto surface = m_world.surface_height(wx, wz);
+                const ChunkCoord lit_from =
+                    surface ? std::max(*surface + 1, base_y) : base_y;
+
+                for (ChunkCoord wy = lit_from; wy <= top_y; ++wy) {
+                    const LocalCoord ly = World::world_to_local(wy);
+                    Voxel voxel = chunk->get(lx, ly, lz);
+                    voxel.set_sunlight(MAX_LIGHT);
+                    chunk->set(lx, ly, lz, voxel);
+                }
+
+                // Sky cells beside a taller neighbor column can feed it
+                // sideways - they are the whole sunlight BFS frontier
+                ChunkCoord neighbor_top = base_y - 1;
+                static constexpr std::array<std::array<ChunkCoord, 2>, 4> around = {{
+                    {-1, 0}, {1, 0}, {0, -1}, {0, 1}
+                }};
+                for (const auto& off : around) {
+                    const auto h = m_world.surface_height(wx + off[0], wz + off[1]);
+                    if (h) {
+                        neighbor_top = std::max(neighbor_top, *h);
+                    }
+                }
+                const ChunkCoord frontier_top = std::min(neighbor_top, top_y);
+                for (ChunkCoord wy = lit_from; wy <= frontier_top; ++wy) {
+                    m_sun_add.push_back(LightNode{wx, wy, wz});
+                }
+
+                // Emitters below the surface (the sky fill above never
+                // overwrites torchlight, so scan the dark part only)
+                const ChunkCoord scan_top = std::min(lit_from - 1, top_y);
+                for (ChunkCoord wy = base_y; wy <= scan_top; ++wy) {
+                    const LocalCoord ly = World::world_to_local(wy);
+                    Voxel voxel = chunk->get(lx, ly, lz);
+                    const std::uint8_t emission =
+                        registry.get(voxel.type_id()).light_emission;
+                    if (emission > 0) {
+                        voxel.set_torchlight(emission);
+                        chunk->set(lx, ly, lz, voxel);
+                        m_torch_add.push_back(LightNode{wx, wy, wz});
+                    }
+                }
+            }
+        }
+
+        // Pull light across the seams: enqueue lit boundary cells of
+        // resident face neighbors so their next BFS pop flows inward
+        seed_from_neighbors(pos, *chunk);
+
+        m_world.mark_chunk_dirty(pos);
+    }
+
+    [[nodiscard]] std::size_t pending_nodes() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_pending_changes.size() + m_sun_add.size() + m_torch_add.size() +
+               m_sun_remove.size() + m_torch_remove.size();
+    }
+
+private:
+    enum class Channel : std::uint8_t { SUN, TORCH };
+
+    struct LightNode {
+        ChunkCoord x, y, z;
+    };
+
+    // Removal carries the level the cell held before it was zeroed; the
+    // wave only follows neighbors strictly darker than that, so it never
+    // eats light fed from another source
+    struct RemovalNode {
+        ChunkCoord x, y, z;
+        std::uint8_t level;
+    };
+
+    static constexpr std::array<std::array<ChunkCoord, 3>, 6> OFFSETS = {{
+        {-1, 0, 0}, {1, 0, 0},
+        {0, -1, 0}, {0, 1, 0},
+        {0, 0, -1}, {0, 0, 1}
+    }};
+
+    // =============================================================================
+    // TICK-SCOPED CHUNK CACHE
+    // Same shape as FluidSimulator's: one world lookup per touched chunk
+    // per tick, reads and writes through the held Chunk* with local
+    // coordinates, dirty marking batched and flushed once per chunk.
+    // Lighting never loads chunks - the wave stops at the loaded edge and
+    // initialize_chunk_light pulls it across when the neighbor arrives.
+    // =============================================================================
+    struct TickContext {
+        World& world;
+        std::unordered_map<ChunkPosition, Chunk*> chunks;
+        std::unordered_set<ChunkPosition> dirty;
+
+        [[nodiscard]] Chunk* find(ChunkPosition pos) {
+            auto it = chunks.find(pos);
+            if (it != chunks.end()) {
+                return it->second;
+            }
+            Chunk* chunk = world.get_chunk_mut(pos);
+            chunks.emplace(pos, chunk);
+            return chunk;
+        }
+
+        [[nodiscard]] Voxel get(ChunkCoord x, ChunkCoord y, ChunkCoord z) {
+            const Chunk* chunk = find(World::world_to_chunk_pos(x, y, z));
+            if (!chunk) {
+                return Voxel{};
+            }
+            return chunk->get(World::world_to_local(x),
+                              World::world_to_local(y),
+                              World::world_to_local(z));
+        }
+
+        [[nodiscard]] std::uint8_t level(Channel channel,
+                                         ChunkCoord x, ChunkCoord y, ChunkCoord z) {
+            const Voxel voxel = get(x, y, z);
+            return channel == Channel::SUN ? voxel.sunlight() : voxel.torchlight();
+        }
+
+        // Read-modify-write one nibble; no-op where no chunk is loaded.
+        // Border writes mark the adjacent chunk too, since its mesh bakes
+        // light from cells on this side of the seam.
+        void set_level(Channel channel, ChunkCoord x, ChunkCoord y, ChunkCoord z,
+                       std::uint8_t value) {
+            const ChunkPosition pos = World::world_to_chunk_pos(x, y, z);
+            Chunk* chunk = find(pos);
+            if (!chunk) {
+                return;
+            }
+            const LocalCoord lx = World::world_to_local(x);
+            const LocalCoord ly = World::world_to_local(y);
+            const LocalCoord lz = World::world_to_local(z);
+            Voxel voxel = chunk->get(lx, ly, lz);
+            if (channel == Channel::SUN) {
+                voxel.set_sunlight(value);
+            } else {
+                voxel.set_torchlight(value);
+            }
+            chunk->set(lx, ly, lz, voxel);
+
+            dirty.insert(pos);
+            if (lx == 0) {
+                dirty.insert(ChunkPosition{pos.x - 1, pos.y, pos.z});
+            } else if (lx == static_cast<LocalCoord>(CHUNK_SIZE_X - 1)) {
+                dirty.insert(ChunkPosition{pos.x + 1, pos.y, pos.z});
+            }
+            if (ly == 0) {
+                dirty.insert(ChunkPosition{pos.x, pos.y - 1, pos.z});
+            } else if (ly == static_cast<LocalCoord>(CHUNK_SIZE_Y - 1)) {
+                dirty.insert(ChunkPosition{pos.x, pos.y + 1, pos.z});
+            }
+            if (lz == 0) {
+                dirty.insert(ChunkPosition{pos.x, pos.y, pos.z - 1});
+            } else if (lz == static_cast<LocalCoord>(CHUNK_SIZE_Z - 1)) {
+                dirty.insert(ChunkPosition{pos.x, pos.y, pos.z + 1});
+            }
+        }
+    };
+
+    // How much a cell dims light passing through it: air is free, an
+    // opaque block is a wall, transparent blocks (water, leaves) charge
+    // their registry filter on top of the base step
+    [[nodiscard]] static std::uint8_t opacity(const Voxel& voxel) {
+        if (voxel.is_air()) {
+            return 0;
+        }
+        const auto& props = BlockRegistry::instance().get(voxel.type_id());
+        if (props.blocks_light()) {
+            return MAX_LIGHT;
+        }
+        return props.light_filter;
+    }
+
+    void process_updates() {
+        std::vector<LightNode> changes;
+        std::vector<LightNode> sun_add;
+        std::vector<LightNode> torch_add;
+        std::vector<RemovalNode> sun_remove;
+        std::vector<RemovalNode> torch_remove;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            changes.swap(m_pending_changes);
+            sun_add.swap(m_sun_add);
+            torch_add.swap(m_torch_add);
+            sun_remove.swap(m_sun_remove);
+            torch_remove.swap(m_torch_remove);
+        }
+
+        TickContext ctx{m_world, {}, {}};
+
+        // Edits first: they seed this tick's removal and add waves
+        for (const LightNode& node : changes) {
+            process_block_change(ctx, node, sun_add, torch_add, sun_remove, torch_remove);
+        }
+
+        // Removal before propagation: re-adding into a half-cleared hole
+        // would let the old light feed itself back
+        std::size_t budget = MAX_NODES_PER_TICK;
+        propagate_removal(ctx, Channel::SUN, sun_remove, sun_add, budget);
+        propagate_removal(ctx, Channel::TORCH, torch_remove, torch_add, budget);
+        propagate(ctx, Channel::SUN, sun_add, budget);
+        propagate(ctx, Channel::TORCH, torch_add, budget);
+
+        // Budget exhausted mid-wave: carry the remainder into next tick
+        if (!sun_add.empty() || !torch_add.empty() ||
+            !sun_remove.empty() || !torch_remove.empty()) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            requeue(m_sun_add, sun_add);
+            requeue(m_torch_add, torch_add);
+            requeue(m_sun_remove, sun_remove);
+            requeue(m_torch_remove, torch_remove);
+        }
+
+        // One remesh notification per touched chunk
+        for (const ChunkPosition& pos : ctx.dirty) {
+            m_world.mark_chunk_dirty(pos);
+        }
+    }
+
+    // Relight one edited cell: zero both channels (seeding removals with
+    // the preserved pre-edit levels), restore the new block's emission,
+    // and let the neighbors refill whatever the cell can now hold
+    void process_block_change(TickContext& ctx, const LightNode& node,
+                              std::vector<LightNode>& sun_add,
+                              std::vector<LightNode>& torch_add,
+                              std::vector<RemovalNode>& sun_remove,
+                              std::vector<RemovalNode>& torch_remove) {
+        const Voxel voxel = ctx.get(node.x, node.y, node.z);
+
+        const std::uint8_t old_sun = voxel.sunlight();
+        if (old_sun > 0) {
+            ctx.set_level(Channel::SUN, node.x, node.y, node.z, 0);
+            sun_remove.push_back(RemovalNode{node.x, node.y, node.z, old_sun});
+        }
+        const std::uint8_t old_torch = voxel.torchlight();
+        if (old_torch > 0) {
+            ctx.set_level(Channel::TORCH, node.x, node.y, node.z, 0);
+            torch_remove.push_back(RemovalNode{node.x, node.y, node.z, old_torch});
+        }
+
+        const std::uint8_t emission =
+            BlockRegistry::instance().get(voxel.type_id()).light_emission;
+        if (emission > 0) {
+            ctx.set_level(Channel::TORCH, node.x, node.y, node.z, emission);
+            torch_add.push_back(LightNode{node.x, node.y, node.z});
+        }
+
+        // A cell that passes light again (block broken, glass placed)
+        // refills from whichever neighbors still hold some
+        if (opacity(voxel) < MAX_LIGHT) {
+            for (const auto& off : OFFSETS) {
+                const LightNode n{node.x + off[0], node.y + off[1], node.z + off[2]};
+                sun_add.push_back(n);
+                torch_add.push_back(n);
+            }
+        }
+    }
+
+    // Standard flood fill: each pop spreads level - step to darker
+    // neighbors. Full sunlight travels straight down for free, which is
+    // what keeps a column relight O(depth) instead of O(depth * width).
+    void propagate(TickContext& ctx, Channel channel,
+                   std::vector<LightNode>& queue, std::size_t& budget) {
+        std::size_t head = 0;
+        while (head < queue.size() && budget > 0) {
+            --budget;
+            const LightNode node = queue[head++];
+            const std::uint8_t level = ctx.level(channel, node.x, node.y, node.z);
+            if (level <= 1) {
+                continue;
+            }
+
+            for (const auto& off : OFFSETS) {
+                const ChunkCoord nx = node.x + off[0];
+                const ChunkCoord ny = node.y + off[1];
+                const ChunkCoord nz = node.z + off[2];
+                const Voxel neighbor = ctx.get(nx, ny, nz);
+                const std::uint8_t op = opacity(neighbor);
+                if (op >= MAX_LIGHT) {
+                    continue;
+                }
+
+                std::uint8_t target;
+                if (channel == Channel::SUN && off[1] == -1 &&
+                    level == MAX_LIGHT && op == 0) {
+                    target = MAX_LIGHT;  // Sky column: no falloff downward
+                } else {
+                    const std::uint8_t step = std::max<std::uint8_t>(1, op);
+                    target = level > step ? static_cast<std::uint8_t>(level - step) : 0;
+                }
+
+                const std::uint8_t current =
+                    channel == Channel::SUN ? neighbor.sunlight() : neighbor.torchlight();
+                if (target > current) {
+                    ctx.set_level(channel, nx, ny, nz, target);
+                    queue.push_back(LightNode{nx, ny, nz});
+                }
+            }
+        }
+        queue.erase(queue.begin(), queue.begin() + static_cast<std::ptrdiff_t>(head));
+    }
+
+    // Un-fill: neighbors darker than the removed level were fed by it
+    // and go dark too; brighter or equal neighbors are independent
+    // sources and become the re-propagation frontier
+    void propagate_removal(TickContext& ctx, Channel channel,
+                           std::vector<RemovalNode>& queue,
+                           std::vector<LightNode>& add_queue, std::size_t& budget) {
+        std::size_t head = 0;
+        while (head < queue.size() && budget > 0) {
+            --budget;
+            const RemovalNode node = queue[head++];
+
+            for (const auto& off : OFFSETS) {
+                const ChunkCoord nx = node.x + off[0];
+                const ChunkCoord ny = node.y + off[1];
+                const ChunkCoord nz = node.z + off[2];
+                const std::uint8_t nl = ctx.level(channel, nx, ny, nz);
+                if (nl == 0) {
+                    continue;
+                }
+
+                // A full-sun cell below a removed full-sun cell was fed
+                // by the free downward path even though levels are equal
+                const bool fed_by_removed =
+                    nl < node.level ||
+                    (channel == Channel::SUN && off[1] == -1 &&
+                     node.level == MAX_LIGHT && nl == MAX_LIGHT);
+                if (fed_by_removed) {
+                    ctx.set_level(channel, nx, ny, nz, 0);
+                    queue.push_back(RemovalNode{nx, ny, nz, nl});
+                } else {
+                    add_queue.push_back(LightNode{nx, ny, nz});
+                }
+            }
+        }
+        queue.erase(queue.begin(), queue.begin() + static_cast<std::ptrdiff_t>(head));
+    }
+
+    // Enqueue boundary cells of each resident face neighbor that can
+    // actually brighten the facing cell of a freshly seeded chunk.
+    // Comparing against the seeded levels first keeps a flat-terrain
+    // chunk load at zero nodes instead of one per boundary cell.
+    // Caller holds m_mutex.
+    void seed_from_neighbors(ChunkPosition pos, const Chunk& own) {
+        for (std::size_t face = 0; face < OFFSETS.size(); ++face) {
+            const ChunkPosition npos{pos.x + OFFSETS[face][0],
+                                     pos.y + OFFSETS[face][1],
+                                     pos.z + OFFSETS[face][2]};
+            const Chunk* neighbor = m_world.get_chunk(npos);
+            if (!neighbor) {
+                continue;
+            }
+
+            // The neighbor's layer facing us: moving toward -axis means
+            // its +axis boundary, and vice versa; ours is the mirror
+            const std::uint32_t axis = static_cast<std::uint32_t>(face) >> 1;
+            const bool negative = (face & 1u) == 0;
+            const LocalCoord their_layer =
+                negative ? static_cast<LocalCoord>(CHUNK_SIZE_X - 1) : 0;
+            const LocalCoord own_layer =
+                negative ? 0 : static_cast<LocalCoord>(CHUNK_SIZE_X - 1);
+
+            // Light entering from the chunk above keeps full sunlight
+            const bool from_above = (axis == 1 && !negative);
+
+            const ChunkCoord nbase_x = coord::chunk_to_world(npos.x);
+            const ChunkCoord nbase_y = coord::chunk_to_world(npos.y);
+            const ChunkCoord nbase_z = coord::chunk_to_world(npos.z);
+
+            for (LocalCoord a = 0; a < static_cast<LocalCoord>(CHUNK_SIZE_X); ++a) {
+                for (LocalCoord b = 0; b < static_cast<LocalCoord>(CHUNK_SIZE_X); ++b) {
+                    LocalCoord lx, ly, lz, ox, oy, oz;
+                    switch (axis) {
+                        case 0:  lx = their_layer; ly = a; lz = b;
+                                 ox = own_layer; oy = a; oz = b; break;
+                        case 1:  lx = a; ly = their_layer; lz = b;
+                                 ox = a; oy = own_layer; oz = b; break;
+                        default: lx = a; ly = b; lz = their_layer;
+                                 ox = a; oy = b; oz = own_layer; break;
+                    }
+                    const Voxel theirs = neighbor->get(lx, ly, lz);
+                    const Voxel ours = own.get(ox, oy, oz);
+
+                    const std::uint8_t sun = theirs.sunlight();
+                    const std::uint8_t sun_in = (from_above && sun == MAX_LIGHT)
+                        ? MAX_LIGHT
+                        : static_cast<std::uint8_t>(sun > 0 ? sun - 1 : 0);
+                    const std::uint8_t torch = theirs.torchlight();
+                    const std::uint8_t torch_in =
+                        static_cast<std::uint8_t>(torch > 0 ? torch - 1 : 0);
+
+                    if (sun_in > ours.sunlight() || torch_in > ours.torchlight()) {
+                        const LightNode node{nbase_x + lx, nbase_y + ly, nbase_z + lz};
+                        if (sun_in > ours.sunlight()) {
+                            m_sun_add.push_back(node);
+                        }
+                        if (torch_in > ours.torchlight()) {
+                            m_torch_add.push_back(node);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    static void requeue(std::vector<LightNode>& dest, std::vector<LightNode>& src) {
+        dest.insert(dest.end(), src.begin(), src.end());
+    }
+    static void requeue(std::vector<RemovalNode>& dest, std::vector<RemovalNode>& src) {
+        dest.insert(dest.end(), src.begin(), src.end());
+    }
+
+    World& m_world;
+
+    // Pending work, guarded by m_mutex (edits arrive from the main
+    // thread, ticks may run elsewhere); drained with a swap per tick
+    mutable std::mutex m_mutex;
+    std::vector<LightNode> m_pending_changes;
+    std::vector<LightNode> m_sun_add;
+    std::vector<LightNode> m_torch_add;
+    std::vector<RemovalNode> m_sun_remove;
+    std::vector<RemovalNode> m_torch_remove;
+};
+
+} // namespace voxel::server
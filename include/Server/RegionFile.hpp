@@ -0,0 +1,198 @@
+// =============================================================================
+// VOXEL ENGINE - REGION FILE PERSISTENCE
+// Memory-mapped region files: 32x32x32 chunks per file
+// Chunk loads fault data straight from the OS page cache; saves are
+// written back asynchronously on a dedicated writer thread
+// =============================================================================
+#pragma once
+
+#include "Shared/Types.hpp"
+#include "Shared/Chunk.hpp"
+#include "Shared/ThreadPool.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace voxel::server {
+
+// =============================================================================
+// REGION COORDINATES
+// A region spans 32x32x32 chunks (2048^3 voxels, up to 32768 chunk records)
+// =============================================================================
+inline constexpr ChunkCoord REGION_SIZE = 32;
+inline constexpr std::uint32_t REGION_SHIFT = 5;
+inline constexpr std::uint32_t REGION_CHUNK_COUNT = 32u * 32u * 32u;
+
+struct RegionPosition {
+    ChunkCoord x, y, z;
+
+    [[nodiscard]] constexpr bool operator==(const RegionPosition& other) const noexcept = default;
+};
+
+struct RegionPositionHash {
+    [[nodiscard]] std::size_t operator()(const RegionPosition& pos) const noexcept {
+        // Same prime-multiply mixing as ChunkPositionHash
+        std::size_t h = static_cast<std::size_t>(pos.x) * 73856093u;
+        h ^= static_cast<std::size_t>(pos.y) * 19349663u;
+        h ^= static_cast<std::size_t>(pos.z) * 83492791u;
+        return h;
+    }
+};
+
+namespace region {
+
+// Region containing a chunk (arithmetic shift handles negatives)
+[[nodiscard]] constexpr RegionPosition chunk_to_region(ChunkPosition pos) noexcept {
+    return {pos.x >> REGION_SHIFT, pos.y >> REGION_SHIFT, pos.z >> REGION_SHIFT};
+}
+
+// Flat index of a chunk within its region [0, REGION_CHUNK_COUNT)
+[[nodiscard]] constexpr std::uint32_t chunk_to_region_index(ChunkPosition pos) noexcept {
+    const auto lx = static_cast<std::uint32_t>(pos.x & (REGION_SIZE - 1));
+    const auto ly = static_cast<std::uint32_t>(pos.y & (REGION_SIZE - 1));
+    const auto lz = static_cast<std::uint32_t>(pos.z & (REGION_SIZE - 1));
+    return (lx << 10) | (lz << 5) | ly;
+}
+
+} // namespace region
+
+// =============================================================================
+// REGION FILE
+// Single region on disk. Layout:
+//   [FileHeader 16B][IndexEntry table 32768 * 8B][chunk records...]
+// Records are appended; rewrites reuse the old slot when they fit.
+// Reads go through a read-only memory mapping of the whole file, so
+// repeated loads hit the page cache with no explicit read syscalls.
+// =============================================================================
+class RegionFile {
+public:
+    static constexpr std::uint32_t MAGIC = 0x56585247;   // 'VXRG'
+    static constexpr std::uint32_t VERSION = 1;
+
+    // Chunk record encodings
+    enum class RecordMode : std::uint32_t {
+        UNIFORM     = 0,  // Payload: single 4-byte voxel value
+        DENSE_RAW   = 1,  // Payload: full 1 MiB flat voxel array
+        PALETTE_RLE = 2   // Payload: Shared/ChunkCodec.hpp record (few KiB)
+    };
+
+    explicit RegionFile(std::string path);
+    ~RegionFile();
+
+    // Non-copyable, non-movable (owns OS handles and a mapping)
+    RegionFile(const RegionFile&) = delete;
+    RegionFile& operator=(const RegionFile&) = delete;
+    RegionFile(RegionFile&&) = delete;
+    RegionFile& operator=(RegionFile&&) = delete;
+
+    [[nodiscard]] bool is_open() const noexcept { return m_open; }
+
+    // Load a chunk record into the given chunk
+    // Returns false if no record exists (caller should generate)
+    bool load_chunk(std::uint32_t index, Chunk& chunk);
+
+    // Write a chunk record (synchronous; called from the writer thread)
+    bool save_chunk(std::uint32_t index, const Chunk& chunk);
+
+private:
+    struct FileHeader {
+        std::uint32_t magic;
+        std::uint32_t version;
+        std::uint64_t reserved;
+    };
+
+    struct IndexEntry {
+        std::uint32_t offset;   // Record offset in 16-byte units (0 = absent)
+        std::uint32_t size;     // Record payload size in bytes
+    };
+
+    struct RecordHeader {
+        std::uint32_t mode;     // RecordMode
+        std::uint32_t size;     // Payload size in bytes
+    };
+
+    static constexpr std::size_t INDEX_OFFSET = sizeof(FileHeader);
+    static constexpr std::size_t DATA_OFFSET =
+        INDEX_OFFSET + REGION_CHUNK_COUNT * sizeof(IndexEntry);
+
+    bool open_or_create();
+    void close_file() noexcept;
+
+    // Refresh the read mapping to cover the current file size
+    bool remap();
+    void unmap() noexcept;
+
+    // Raw positional I/O (platform-specific)
+    bool write_at(std::uint64_t offset, const void* data, std::size_t size);
+    [[nodiscard]] std::uint64_t file_size() const noexcept;
+
+    // Persist a single index entry
+    bool write_index_entry(std::uint32_t index);
+
+    std::string m_path;
+    bool m_open = false;
+
+#if defined(_WIN32)
+    void* m_file = nullptr;        // HANDLE
+    void* m_mapping = nullptr;     // HANDLE to file mapping object
+#else
+    int m_fd = -1;
+#endif
+
+    const std::uint8_t* m_map = nullptr;
+    std::uint64_t m_map_size = 0;
+
+    std::vector<IndexEntry> m_index;
+    std::mutex m_mutex;
+};
+
+// =============================================================================
+// REGION MANAGER
+// Owns all open region files for one world, rooted at saves/<world name>/.
+// Loads are synchronous (page-cache backed); saves are queued onto a
+// single writer thread so unload_chunk never blocks on disk.
+// =============================================================================
+class RegionManager {
+public:
+    explicit RegionManager(std::string world_name);
+    ~RegionManager();
+
+    // Non-copyable, non-movable
+    RegionManager(const RegionManager&) = delete;
+    RegionManager& operator=(const RegionManager&) = delete;
+    RegionManager(RegionManager&&) = delete;
+    RegionManager& operator=(RegionManager&&) = delete;
+
+    // Try to populate a chunk from disk; false if no record exists
+    bool load_chunk(ChunkPosition pos, Chunk& chunk);
+
+    // Queue a chunk for asynchronous write-back (takes ownership;
+    // the chunk is destroyed on the writer thread after saving)
+    void save_chunk_async(std::unique_ptr<Chunk> chunk);
+
+    // Synchronous save (used during shutdown)
+    void save_chunk(const Chunk& chunk);
+
+    // Block until all queued writes have hit the OS
+    void flush();
+
+    [[nodiscard]] const std::string& directory() const noexcept { return m_directory; }
+
+private:
+    [[nodiscard]] RegionFile* region_for(ChunkPosition pos);
+
+    std::string m_directory;
+
+    std::mutex m_regions_mutex;
+    std::unordered_map<RegionPosition, std::unique_ptr<RegionFile>, RegionPositionHash> m_regions;
+
+    // Single writer thread keeps region files internally consistent
+    // without per-record cross-thread ordering concerns
+    ThreadPool m_writer{1};
+};
+
+} // namespace voxel::server
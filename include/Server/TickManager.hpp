@@ -7,9 +7,18 @@
 
 #include "Shared/Types.hpp"
 
+#include <algorithm>
+#include <array>
 #include <chrono>
+#include <cstring>
 #include <functional>
 #include <atomic>
+#include <string_view>
+#include <vector>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <x86intrin.h>
+#endif
 
 namespace voxel::server {
 
@@ -56,6 +65,192 @@ struct TickStats {
     double accumulator_ms = 0.0;            // Current accumulator value
     bool is_running = false;                // Simulation running state
     bool is_lagging = false;                // True if can't keep up with target TPS
+    std::uint64_t system_overruns = 0;      // Scheduled runs that blew their budget
+    std::uint64_t system_deferrals = 0;     // Eligible runs skipped to repay overruns
+};
+
+// =============================================================================
+// SCHEDULED SYSTEM CONFIGURATION
+// Interval and phase place a system on the tick grid: a system with
+// interval 5 and phase 2 runs on ticks 2, 7, 12, ... - so two 5-tick
+// systems with different phases never land on the same tick. The budget
+// is advisory (callbacks are not preempted); a run that exceeds it puts
+// the system in debt, and eligible ticks are skipped until the debt is
+// repaid at budget_ms per skipped run.
+// =============================================================================
+struct TickSystemConfig {
+    std::uint32_t interval = 1;   // Run every N ticks (>= 1)
+    std::uint32_t phase = 0;      // Offset within the interval
+    double budget_ms = 0.0;       // Per-run time budget; 0 = unbounded
+};
+
+// Per-system scheduling counters (queried by the overlay)
+struct TickSystemStats {
+    char name[24];
+    std::uint64_t runs = 0;        // Times the callback actually ran
+    std::uint64_t overruns = 0;    // Runs that exceeded the budget
+    std::uint64_t deferrals = 0;   // Eligible ticks skipped repaying debt
+    double last_ms = 0.0;          // Duration of the most recent run
+};
+
+// =============================================================================
+// TICK PROFILER
+// Named zones that tick callbacks open/close around their work. The hot
+// path is one timestamp read at open and one ring-buffer store at close
+// (TSC where available) - no allocation, no locking. Percentiles come
+// from a rolling window per zone and are computed only when queried,
+// so the overlay pays the sort, not the tick.
+// =============================================================================
+class TickProfiler {
+public:
+    static constexpr std::size_t MAX_ZONES = 16;
+    static constexpr std::size_t SAMPLE_WINDOW = 256;  // Rolling samples per zone
+    static constexpr std::size_t NAME_CAPACITY = 24;
+
+    using ZoneId = std::uint8_t;
+    static constexpr ZoneId INVALID_ZONE = 0xFF;
+
+    // Rolling percentile summary for one zone, in milliseconds
+    struct ZoneStats {
+        char name[NAME_CAPACITY];
+        std::uint64_t samples;  // Total recordings (window may hold fewer)
+        double p50_ms;
+        double p95_ms;
+        double p99_ms;
+        double max_ms;
+    };
+
+    TickProfiler()
+        : m_calib_stamp(timestamp())
+        , m_calib_time(Clock::now())
+    {}
+
+    // Register a zone by name (cold path; repeated names return the
+    // existing id, INVALID_ZONE once all slots are taken)
+    [[nodiscard]] ZoneId register_zone(std::string_view name) {
+        for (std::size_t i = 0; i < m_zone_count; ++i) {
+            if (name == m_zones[i].name) {
+                return static_cast<ZoneId>(i);
+            }
+        }
+        if (m_zone_count >= MAX_ZONES) {
+            return INVALID_ZONE;
+        }
+        Zone& zone = m_zones[m_zone_count];
+        const std::size_t len = std::min(name.size(), NAME_CAPACITY - 1);
+        std::memcpy(zone.name, name.data(), len);
+        zone.name[len] = '\0';
+        return static_cast<ZoneId>(m_zone_count++);
+    }
+
+    // RAII zone scope: records the elapsed interval on destruction
+    class Scope {
+    public:
+        Scope(TickProfiler& profiler, ZoneId zone) noexcept
+            : m_profiler(&profiler), m_zone(zone), m_start(timestamp()) {}
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+        ~Scope() {
+            if (m_zone != INVALID_ZONE) {
+                m_profiler->record(m_zone, timestamp() - m_start);
+            }
+        }
+
+    private:
+        TickProfiler* m_profiler;
+        ZoneId m_zone;
+        std::uint64_t m_start;
+    };
+
+    [[nodiscard]] Scope scope(ZoneId zone) noexcept {
+        return Scope(*this, zone);
+    }
+
+    // Store one raw-tick interval (hot path: ring write + counter)
+    void record(ZoneId zone, std::uint64_t elapsed) noexcept {
+        if (zone >= m_zone_count) {
+            return;
+        }
+        Zone& z = m_zones[zone];
+        z.ring[z.head] = elapsed;
+        z.head = (z.head + 1) % SAMPLE_WINDOW;
+        ++z.samples;
+    }
+
+    // Percentile summaries for all registered zones (cold path: copies
+    // and partially sorts each window)
+    [[nodiscard]] std::vector<ZoneStats> query() const {
+        const double ms_per_stamp = calibrate();
+
+        std::vector<ZoneStats> result;
+        result.reserve(m_zone_count);
+
+        std::array<std::uint64_t, SAMPLE_WINDOW> window;
+        for (std::size_t i = 0; i < m_zone_count; ++i) {
+            const Zone& zone = m_zones[i];
+            const std::size_t count =
+                static_cast<std::size_t>(std::min<std::uint64_t>(zone.samples, SAMPLE_WINDOW));
+            if (count == 0) {
+                continue;
+            }
+            std::copy_n(zone.ring.begin(), count, window.begin());
+            std::sort(window.begin(), window.begin() + static_cast<std::ptrdiff_t>(count));
+
+            const auto percentile = [&](double p) {
+                const std::size_t rank =
+                    std::min(count - 1, static_cast<std::size_t>(p * static_cast<double>(count)));
+                return static_cast<double>(window[rank]) * ms_per_stamp;
+            };
+
+            ZoneStats stats{};
+            std::memcpy(stats.name, zone.name, NAME_CAPACITY);
+            stats.samples = zone.samples;
+            stats.p50_ms = percentile(0.50);
+            stats.p95_ms = percentile(0.95);
+            stats.p99_ms = percentile(0.99);
+            stats.max_ms = static_cast<double>(window[count - 1]) * ms_per_stamp;
+            result.push_back(stats);
+        }
+        return result;
+    }
+
+private:
+    struct Zone {
+        char name[NAME_CAPACITY] = {};
+        std::array<std::uint64_t, SAMPLE_WINDOW> ring{};
+        std::uint64_t samples = 0;
+        std::size_t head = 0;
+    };
+
+    // Raw timestamp: TSC on x86-64 (one instruction, no syscall), the
+    // steady clock elsewhere
+    [[nodiscard]] static std::uint64_t timestamp() noexcept {
+#if defined(__x86_64__) || defined(_M_X64)
+        return __rdtsc();
+#else
+        return static_cast<std::uint64_t>(Clock::now().time_since_epoch().count());
+#endif
+    }
+
+    // Milliseconds per raw tick, measured against the steady clock over
+    // the profiler's whole lifetime (invariant TSC makes this stable)
+    [[nodiscard]] double calibrate() const {
+        const std::uint64_t stamp_delta = timestamp() - m_calib_stamp;
+        if (stamp_delta == 0) {
+            return 0.0;
+        }
+        const double elapsed_ms =
+            std::chrono::duration<double, std::milli>(Clock::now() - m_calib_time).count();
+        return elapsed_ms / static_cast<double>(stamp_delta);
+    }
+
+    std::array<Zone, MAX_ZONES> m_zones{};
+    std::size_t m_zone_count = 0;
+
+    std::uint64_t m_calib_stamp;
+    TimePoint m_calib_time;
 };
 
 // =============================================================================
@@ -82,6 +277,7 @@ public:
         , m_last_update(Clock::now())
         , m_last_stats_update(Clock::now())
         , m_ticks_this_second(0)
+        , m_tick_zone(m_profiler.register_zone("tick"))
     {}
 
     explicit TickManager(TickConfig config)
@@ -92,6 +288,7 @@ public:
         , m_last_update(Clock::now())
         , m_last_stats_update(Clock::now())
         , m_ticks_this_second(0)
+        , m_tick_zone(m_profiler.register_zone("tick"))
     {}
 
     // Non-copyable, movable
@@ -169,7 +366,7 @@ public:
     // Returns the interpolation alpha for rendering
     // =============================================================================
 
-    [[nodiscard]] double update(TickCallback on_tick) {
+    [[nodiscard]] double update(TickCallback on_tick = nullptr) {
         if (!is_running()) {
             return 0.0;
         }
@@ -205,9 +402,13 @@ public:
         while (m_accumulator >= tick_duration && ticks_processed < m_config.max_ticks_per_frame) {
             // Execute simulation tick
             if (on_tick) {
+                TickProfiler::Scope tick_scope = m_profiler.scope(m_tick_zone);
                 on_tick(delta_time, m_stats.total_ticks);
             }
 
+            // Registered systems whose slot falls on this tick
+            run_systems(delta_time, m_stats.total_ticks);
+
             m_accumulator -= tick_duration;
             ++m_stats.total_ticks;
             ++m_ticks_this_second;
@@ -256,6 +457,48 @@ public:
         return m_stats.tick_time_ms;
     }
 
+    // Per-system tick profiler: systems register zones once and open a
+    // scope around their work inside the tick callback. The built-in
+    // "tick" zone covers each whole callback invocation.
+    [[nodiscard]] TickProfiler& profiler() noexcept { return m_profiler; }
+    [[nodiscard]] const TickProfiler& profiler() const noexcept { return m_profiler; }
+
+    // =============================================================================
+    // SCHEDULED SYSTEMS
+    // =============================================================================
+
+    // Register a system on the tick grid. Each system also gets a
+    // profiler zone under its name. Returns an index usable with
+    // system_stats(); registration order is execution order within a tick.
+    std::size_t register_system(std::string_view name, TickSystemConfig config, TickCallback callback) {
+        System sys;
+        const std::size_t len = std::min(name.size(), sizeof(sys.name) - 1);
+        std::memcpy(sys.name, name.data(), len);
+        sys.name[len] = '\0';
+        sys.config = config;
+        sys.config.interval = std::max<std::uint32_t>(sys.config.interval, 1);
+        sys.callback = std::move(callback);
+        sys.zone = m_profiler.register_zone(name);
+        m_systems.push_back(std::move(sys));
+        return m_systems.size() - 1;
+    }
+
+    // Scheduling counters for every registered system
+    [[nodiscard]] std::vector<TickSystemStats> system_stats() const {
+        std::vector<TickSystemStats> result;
+        result.reserve(m_systems.size());
+        for (const System& sys : m_systems) {
+            TickSystemStats stats{};
+            std::memcpy(stats.name, sys.name, sizeof(stats.name));
+            stats.runs = sys.runs;
+            stats.overruns = sys.overruns;
+            stats.deferrals = sys.deferrals;
+            stats.last_ms = sys.last_ms;
+            result.push_back(stats);
+        }
+        return result;
+    }
+
     // =============================================================================
     // TIME UTILITIES
     // =============================================================================
@@ -272,6 +515,51 @@ public:
     }
 
 private:
+    struct System {
+        char name[24] = {};
+        TickSystemConfig config;
+        TickCallback callback;
+        TickProfiler::ZoneId zone = TickProfiler::INVALID_ZONE;
+        double debt_ms = 0.0;      // Unpaid overrun time
+        std::uint64_t runs = 0;
+        std::uint64_t overruns = 0;
+        std::uint64_t deferrals = 0;
+        double last_ms = 0.0;
+    };
+
+    // Run every system whose (interval, phase) slot falls on this tick.
+    // A system in budget debt skips the run and repays one budget's
+    // worth instead, so a spike spreads over later slots rather than
+    // stacking onto the next one.
+    void run_systems(double delta_time, std::uint64_t tick) {
+        for (System& sys : m_systems) {
+            const std::uint32_t interval = sys.config.interval;
+            if (tick % interval != sys.config.phase % interval) {
+                continue;
+            }
+            if (sys.config.budget_ms > 0.0 && sys.debt_ms > 0.0) {
+                sys.debt_ms = std::max(0.0, sys.debt_ms - sys.config.budget_ms);
+                ++sys.deferrals;
+                ++m_stats.system_deferrals;
+                continue;
+            }
+
+            const TimePoint start = Clock::now();
+            {
+                TickProfiler::Scope scope = m_profiler.scope(sys.zone);
+                sys.callback(delta_time, tick);
+            }
+            sys.last_ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+            ++sys.runs;
+
+            if (sys.config.budget_ms > 0.0 && sys.last_ms > sys.config.budget_ms) {
+                sys.debt_ms += sys.last_ms - sys.config.budget_ms;
+                ++sys.overruns;
+                ++m_stats.system_overruns;
+            }
+        }
+    }
+
     void update_stats(TimePoint now) {
         const Duration one_second = std::chrono::seconds(1);
         const Duration since_stats_update = now - m_last_stats_update;
@@ -292,6 +580,9 @@ private:
     TimePoint m_last_update;
     TimePoint m_last_stats_update;
     std::uint32_t m_ticks_this_second;
+    TickProfiler m_profiler;
+    TickProfiler::ZoneId m_tick_zone;
+    std::vector<System> m_systems;
 };
 
 } // namespace voxel::server
@@ -7,9 +7,14 @@
 #include "Shared/Types.hpp"
 #include "Shared/Chunk.hpp"
 
+#include <array>
+#include <atomic>
+#include <future>
+#include <limits>
 #include <memory>
 #include <shared_mutex>
 #include <mutex>
+#include <span>
 #include <unordered_map>
 #include <unordered_set>
 #include <optional>
@@ -20,6 +25,7 @@ namespace voxel::server {
 
 // Forward declarations
 class WorldGenerator;
+class RegionManager;
 
 // =============================================================================
 // WORLD CONFIGURATION
@@ -37,6 +43,12 @@ struct WorldConfig {
 
     // Generator type identifier
     const char* generator_type = "superflat";
+
+    // Resident-chunk budget for evict_lru (0 = unbounded). Keeps
+    // steady-state memory flat on long sessions: chunks beyond the
+    // caller's retain radius are unloaded least-recently-used first
+    // once the count exceeds this.
+    std::size_t max_resident_chunks = 0;
 };
 
 // =============================================================================
@@ -50,9 +62,15 @@ public:
     using ChunkPtr = std::unique_ptr<Chunk>;
     using ChunkMap = std::unordered_map<ChunkPosition, ChunkPtr>;
 
+    // Number of lock shards for the chunk map (power of two)
+    // Readers on different chunks hash to different shards, so 8+ mesh
+    // workers plus the fluid tick no longer contend on a single lock
+    static constexpr std::size_t SHARD_COUNT = 64;
+
     // Callback types
     using ChunkCallback = std::function<void(Chunk&)>;
     using ChunkConstCallback = std::function<void(const Chunk&)>;
+    using LoadCallback = std::function<void(Chunk*)>;
 
     // =============================================================================
     // CONSTRUCTION
@@ -95,6 +113,19 @@ public:
     [[nodiscard]] bool has_chunk(ChunkPosition pos) const;
     [[nodiscard]] bool has_chunk(ChunkCoord x, ChunkCoord y, ChunkCoord z) const;
 
+    // Capture an immutable snapshot of the chunk plus its six boundary
+    // planes for background meshing. Takes each involved shard lock once
+    // (at most 7 constant-time acquisitions) instead of thousands of
+    // per-voxel get_voxel calls during cross-chunk face culling.
+    // Returns nullptr if the center chunk is not loaded.
+    [[nodiscard]] std::shared_ptr<const PaddedChunkSnapshot> copy_padded_snapshot(ChunkPosition pos) const;
+
+    // Capture an immutable snapshot of a single chunk under the shard's
+    // exclusive lock (Chunk::snapshot() may rebuild its cached copy,
+    // which must not race with writers or other snapshotters). Returns
+    // nullptr if the chunk is not loaded.
+    [[nodiscard]] std::shared_ptr<const Voxel[]> copy_chunk_snapshot(ChunkPosition pos) const;
+
     // =============================================================================
     // CHUNK LIFECYCLE
     // =============================================================================
@@ -104,6 +135,30 @@ public:
     Chunk* load_chunk(ChunkPosition pos);
     Chunk* load_chunk(ChunkCoord x, ChunkCoord y, ChunkCoord z);
 
+    // Schedule load/generation on the shared thread pool
+    // Generation runs into a detached chunk without holding m_chunks_mutex;
+    // the finished chunk is published via insert_chunk and marked dirty so
+    // the mesh pipeline picks it up. The callback is invoked exactly once
+    // per call: on the worker thread once the chunk is visible, or with
+    // nullptr when no chunk was produced for this request (out of bounds,
+    // or a duplicate of a still-pending position) - callers that track
+    // in-flight requests rely on that guarantee.
+    void load_chunk_async(ChunkPosition pos, LoadCallback callback = nullptr);
+
+    // Check if an async load is in flight for this position
+    [[nodiscard]] bool is_load_pending(ChunkPosition pos) const;
+
+    // Load or generate many chunks at once (startup grids, teleports).
+    // Positions are partitioned into one slice per pool worker; each
+    // slice generates into worker-local chunks with no shared state,
+    // then commits them grouped by shard so every shard lock is taken
+    // once per slice instead of once per chunk. New chunks are marked
+    // dirty for the mesh pipeline. The returned future completes when
+    // every position is resident and yields the number of chunks that
+    // were newly created (already-loaded positions are skipped).
+    [[nodiscard]] std::future<std::size_t> load_chunks_batch(
+        std::span<const ChunkPosition> positions);
+
     // Unload chunk at position (saves if dirty)
     bool unload_chunk(ChunkPosition pos);
     bool unload_chunk(ChunkCoord x, ChunkCoord y, ChunkCoord z);
@@ -114,6 +169,14 @@ public:
     // Remove chunk without saving
     ChunkPtr remove_chunk(ChunkPosition pos);
 
+    // Advance the access clock and, while the resident count exceeds
+    // config().max_resident_chunks, unload the least-recently-used
+    // chunks whose column lies outside the retain radius around center
+    // (Chebyshev on X/Z, matching the streamer's unload test). Dirty
+    // chunks are saved by unload_chunk as usual. Returns the evicted
+    // positions so the client can tear down the matching GPU meshes.
+    [[nodiscard]] std::vector<ChunkPosition> evict_lru(ChunkPosition center, ChunkCoord retain_radius);
+
     // =============================================================================
     // VOXEL ACCESS (Thread-Safe, Cross-Chunk)
     // =============================================================================
@@ -141,6 +204,18 @@ public:
     // Marks affected chunk(s) as dirty
     bool place_block(std::int64_t world_x, std::int64_t world_y, std::int64_t world_z, Voxel voxel);
 
+    // =============================================================================
+    // COLUMN HEIGHTMAP CACHE
+    // =============================================================================
+
+    // World Y of the highest non-air voxel in the column at world X/Z,
+    // answered from the per-chunk-column heightmap cache (one array read,
+    // no voxel scan). The cache is filled as chunks generate or load and
+    // kept current by set_voxel, so callers never pay for a downward
+    // get_voxel walk. Returns nullopt while no chunk of the column is
+    // loaded or when the whole loaded column is air.
+    [[nodiscard]] std::optional<ChunkCoord> surface_height(ChunkCoord world_x, ChunkCoord world_z) const;
+
     // =============================================================================
     // DIRTY CHUNK TRACKING
     // =============================================================================
@@ -190,29 +265,91 @@ public:
     [[nodiscard]] static bool is_valid_world_pos(ChunkCoord x, ChunkCoord z) noexcept;
 
 private:
+    // One lock shard: reader-writer lock plus its slice of the chunk map.
+    // Cache-line aligned so shard locks never false-share.
+    struct alignas(64) ChunkShard {
+        mutable std::shared_mutex mutex;
+        ChunkMap chunks;
+    };
+
     // Generate chunk data using the world generator
     void generate_chunk(Chunk& chunk);
 
-    // Internal chunk lookup (caller must hold appropriate lock)
-    [[nodiscard]] const Chunk* find_chunk_unlocked(ChunkPosition pos) const;
-    [[nodiscard]] Chunk* find_chunk_unlocked(ChunkPosition pos);
+    // Shard selection by position hash
+    [[nodiscard]] ChunkShard& shard_for(ChunkPosition pos) noexcept;
+    [[nodiscard]] const ChunkShard& shard_for(ChunkPosition pos) const noexcept;
+
+    // Internal chunk lookup (caller must hold the shard's lock). Found
+    // chunks are stamped with the current access tick for LRU eviction.
+    [[nodiscard]] Chunk* find_in_shard(ChunkShard& shard, ChunkPosition pos) const;
+    [[nodiscard]] const Chunk* find_in_shard(const ChunkShard& shard, ChunkPosition pos) const;
+
+    // One 64x64 grid of cached column tops for a chunk column: world Y of
+    // the highest non-air voxel among loaded chunks. Heap-allocated so a
+    // map rehash moves a pointer instead of a 32 KiB array.
+    struct ColumnHeights {
+        std::array<ChunkCoord, CHUNK_SIZE_X * CHUNK_SIZE_Z> top;
+    };
+
+    // Sentinel: no non-air voxel known in this column
+    static constexpr ChunkCoord COLUMN_EMPTY = std::numeric_limits<ChunkCoord>::min();
+
+    // Flat index into ColumnHeights::top
+    [[nodiscard]] static std::size_t column_index(LocalCoord x, LocalCoord z) noexcept {
+        return static_cast<std::size_t>(x) * CHUNK_SIZE_Z + static_cast<std::size_t>(z);
+    }
+
+    // Fold a freshly generated or disk-loaded chunk's column tops into
+    // the cache (max-merge, so merge order within a column is irrelevant)
+    void merge_chunk_heights(const Chunk& chunk);
+
+    // Incremental update after a single-voxel edit: placing above the
+    // cached top raises it, clearing the cached top triggers a downward
+    // rescan through loaded chunks
+    void update_column_height(ChunkCoord world_x, ChunkCoord world_y, ChunkCoord world_z, bool solid);
+
+    // Recompute one column from the chunks still loaded (chunk unload)
+    void rebuild_column_heights(ChunkCoord chunk_x, ChunkCoord chunk_z);
+
+    // Downward scan for the first non-air voxel strictly below below_y
+    [[nodiscard]] ChunkCoord scan_column_top(ChunkCoord world_x, ChunkCoord world_z, ChunkCoord below_y) const;
 
 private:
     WorldConfig m_config;
     std::unique_ptr<WorldGenerator> m_generator;
 
-    // Chunk storage with reader-writer lock
-    mutable std::shared_mutex m_chunks_mutex;
-    ChunkMap m_chunks;
+    // On-disk persistence (region files under saves/<name>/)
+    std::unique_ptr<RegionManager> m_regions;
+
+    // Sharded chunk storage - concurrent access to different chunks
+    // takes different locks
+    std::array<ChunkShard, SHARD_COUNT> m_shards;
 
     // Dirty chunks that need mesh rebuild
     mutable std::mutex m_dirty_mutex;
     std::unordered_set<ChunkPosition> m_dirty_chunks;
 
-    // Statistics
-    std::uint64_t m_chunks_generated = 0;
-    std::uint64_t m_chunks_loaded = 0;
-    std::uint64_t m_chunks_unloaded = 0;
+    // Async loads in flight (deduplicates load_chunk_async requests)
+    mutable std::mutex m_pending_mutex;
+    std::unordered_set<ChunkPosition> m_pending_loads;
+
+    // Per-column heightmap cache, keyed by the column's chunk X/Z (Y is
+    // always 0 in the key). Guarded by its own lock; the heightmap lock
+    // is never held while a shard lock is taken, so the two orders
+    // cannot form a cycle.
+    mutable std::shared_mutex m_heightmap_mutex;
+    std::unordered_map<ChunkPosition, std::unique_ptr<ColumnHeights>> m_heightmaps;
+
+    // LRU access clock: advanced once per evict_lru call, read
+    // (relaxed) by every chunk lookup to stamp the found chunk. Tick
+    // granularity keeps the hot path to one uncontended atomic load
+    // instead of a fetch_add per access.
+    std::atomic<std::uint64_t> m_access_clock{1};
+
+    // Statistics (atomic: bumped from worker threads)
+    std::atomic<std::uint64_t> m_chunks_generated{0};
+    std::atomic<std::uint64_t> m_chunks_loaded{0};
+    std::atomic<std::uint64_t> m_chunks_unloaded{0};
 };
 
 } // namespace voxel::server
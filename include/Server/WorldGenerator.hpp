@@ -7,9 +7,12 @@
 #include "Shared/Types.hpp"
 #include "Shared/Chunk.hpp"
 
+#include <array>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string_view>
+#include <unordered_map>
 
 namespace voxel::server {
 
@@ -162,6 +165,91 @@ private:
     SuperflatConfig m_config;
 };
 
+// =============================================================================
+// NOISE TERRAIN GENERATOR CONFIGURATION
+// =============================================================================
+struct NoiseTerrainConfig : public GeneratorConfig {
+    // fBm parameters (frequency is cycles per block at octave 0)
+    float frequency = 1.0f / 256.0f;
+    std::uint32_t octaves = 5;
+    float lacunarity = 2.0f;
+    float persistence = 0.5f;
+
+    // Height shaping: surface = base_height + amplitude * fbm, fbm in [-1, 1]
+    std::int32_t base_height = 64;
+    float amplitude = 48.0f;
+
+    // Soil layering below the grass surface block
+    std::uint32_t dirt_depth = 3;
+
+    // Create default rolling-hills config
+    static NoiseTerrainConfig default_config() {
+        return NoiseTerrainConfig{};
+    }
+};
+
+// =============================================================================
+// NOISE TERRAIN GENERATOR
+// Procedural heightfield terrain from fBm value noise. The 64x64 surface
+// heightmap is computed once per chunk column (AVX2 batch kernel, 8
+// columns per iteration, scalar fallback) and cached so every chunk in
+// the vertical range min_chunk_y..max_chunk_y reuses it.
+// =============================================================================
+class NoiseTerrainGenerator final : public WorldGenerator {
+public:
+    NoiseTerrainGenerator();
+    explicit NoiseTerrainGenerator(NoiseTerrainConfig config);
+    ~NoiseTerrainGenerator() override = default;
+
+    // =============================================================================
+    // WorldGenerator Interface
+    // =============================================================================
+
+    void generate(Chunk& chunk) override;
+
+    [[nodiscard]] std::string_view type_name() const noexcept override {
+        return "noise_terrain";
+    }
+
+    [[nodiscard]] std::uint64_t seed() const noexcept override {
+        return m_config.seed;
+    }
+
+    [[nodiscard]] bool should_generate(ChunkPosition pos) const noexcept override;
+
+    [[nodiscard]] ChunkCoord get_surface_height(
+        ChunkCoord world_x,
+        ChunkCoord world_z) const noexcept override;
+
+    // =============================================================================
+    // Configuration
+    // =============================================================================
+
+    [[nodiscard]] const NoiseTerrainConfig& config() const noexcept { return m_config; }
+    void set_config(NoiseTerrainConfig config);
+
+private:
+    // Surface height per column, row-major (index = z * 64 + x)
+    using Heightmap = std::array<std::int32_t, CHUNK_SIZE_X * CHUNK_SIZE_Z>;
+
+    // Drop the whole cache once it exceeds this many chunk columns;
+    // recomputing a heightmap is cheap compared to tracking LRU order
+    static constexpr std::size_t MAX_CACHED_COLUMNS = 1024;
+
+    // Fetch (or compute and cache) the heightmap for chunk column (cx, cz)
+    [[nodiscard]] std::shared_ptr<const Heightmap> column_heights(
+        ChunkCoord cx, ChunkCoord cz) const;
+
+    void compute_heightmap(ChunkCoord cx, ChunkCoord cz, Heightmap& out) const;
+
+    NoiseTerrainConfig m_config;
+
+    // Heightmap cache, keyed by chunk column (y component always 0).
+    // Mutex-guarded: chunk generation runs on the async load pool.
+    mutable std::mutex m_cache_mutex;
+    mutable std::unordered_map<ChunkPosition, std::shared_ptr<const Heightmap>> m_height_cache;
+};
+
 // =============================================================================
 // GENERATOR FACTORY
 // =============================================================================
@@ -69,6 +69,22 @@ struct BlockProperties {
     }
 };
 
+// =============================================================================
+// PACKED BLOCK FLAGS
+// One byte per block type, rebuilt whenever definitions change. Hot
+// paths (meshing, fluids, collision) test a single bit off one cached
+// byte array instead of dereferencing a 200-byte BlockProperties struct
+// through the singleton per voxel.
+// =============================================================================
+namespace BlockFlags {
+    inline constexpr std::uint8_t SOLID            = 1u << 0;
+    inline constexpr std::uint8_t TRANSPARENT      = 1u << 1;
+    inline constexpr std::uint8_t FLUID            = 1u << 2;
+    inline constexpr std::uint8_t COLLISION        = 1u << 3;  // is_solid && !is_fluid
+    inline constexpr std::uint8_t RENDER_ALL_FACES = 1u << 4;
+    inline constexpr std::uint8_t EMITS_LIGHT      = 1u << 5;  // light_emission > 0
+}
+
 // =============================================================================
 // BLOCK REGISTRY (Singleton)
 // =============================================================================
@@ -167,21 +183,33 @@ public:
         return m_blocks[0]; // Return air for invalid IDs
     }
     
-    // Convenience accessors
+    // Packed flag byte for a block type (BlockFlags bits). Out-of-range
+    // IDs map to air, matching get().
+    [[nodiscard]] std::uint8_t flags(std::uint16_t id) const noexcept {
+        return m_flags[id < MAX_BLOCK_TYPES ? id : 0];
+    }
+
+    // Raw flag LUT for hot loops that index with type_id() directly.
+    // Immutable between load() calls; safe to hoist out of the loop.
+    [[nodiscard]] const std::uint8_t* flags_lut() const noexcept {
+        return m_flags.data();
+    }
+
+    // Convenience accessors (one byte load off the flag LUT)
     [[nodiscard]] bool is_solid(std::uint16_t id) const noexcept {
-        return get(id).is_solid;
+        return (flags(id) & BlockFlags::SOLID) != 0;
     }
-    
+
     [[nodiscard]] bool is_transparent(std::uint16_t id) const noexcept {
-        return get(id).is_transparent;
+        return (flags(id) & BlockFlags::TRANSPARENT) != 0;
     }
-    
+
     [[nodiscard]] bool is_fluid(std::uint16_t id) const noexcept {
-        return get(id).is_fluid;
+        return (flags(id) & BlockFlags::FLUID) != 0;
     }
-    
+
     [[nodiscard]] bool has_collision(std::uint16_t id) const noexcept {
-        return get(id).has_collision();
+        return (flags(id) & BlockFlags::COLLISION) != 0;
     }
     
     [[nodiscard]] std::string_view name(std::uint16_t id) const noexcept {
@@ -342,6 +370,22 @@ private:
                 m_fluid_ids[m_fluid_count++] = static_cast<std::uint16_t>(i);
             }
         }
+        rebuild_flag_lut();
+    }
+
+    // Repack per-type flag bytes after definitions change
+    void rebuild_flag_lut() noexcept {
+        for (std::size_t i = 0; i < MAX_BLOCK_TYPES; ++i) {
+            const BlockProperties& block = m_blocks[i];
+            std::uint8_t packed = 0;
+            if (block.is_solid)           packed |= BlockFlags::SOLID;
+            if (block.is_transparent)     packed |= BlockFlags::TRANSPARENT;
+            if (block.is_fluid)           packed |= BlockFlags::FLUID;
+            if (block.has_collision())    packed |= BlockFlags::COLLISION;
+            if (block.render_all_faces)   packed |= BlockFlags::RENDER_ALL_FACES;
+            if (block.light_emission > 0) packed |= BlockFlags::EMITS_LIGHT;
+            m_flags[i] = packed;
+        }
     }
     
     void parse_property(BlockProperties& block, const std::string& key, const std::string& value) {
@@ -435,6 +479,9 @@ private:
     std::array<BlockProperties, MAX_BLOCK_TYPES> m_blocks{};
     std::array<std::uint16_t, 16> m_fluid_ids{};
     std::size_t m_fluid_count = 0;
+
+    // Packed BlockFlags bytes, one per type (see rebuild_flag_lut)
+    std::array<std::uint8_t, MAX_BLOCK_TYPES> m_flags{};
 };
 
 } // namespace voxel
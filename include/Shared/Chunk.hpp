@@ -2,22 +2,100 @@
 // VOXEL ENGINE - CHUNK CONTAINER
 // Sacred Interface: 64-byte aligned, 64^3 voxel storage
 // Cache-optimized memory layout for SIMD/AVX-512 operations
+// Palette-compressed storage tiers with transparent dense fallback
 // =============================================================================
 #pragma once
 
 #include "Types.hpp"
+#include "Memory.hpp"
 
+#include <array>
+#include <atomic>
 #include <memory>
+#include <vector>
 #include <cstring>
 #include <new>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 namespace voxel {
 
+// =============================================================================
+// CHUNK OCCUPANCY SUMMARY
+// Solid voxel counts per 16^3 sub-region (4x4x4 = 64 regions), produced
+// by Chunk::compute_occupancy_summary() for consumers that want coarse
+// occupancy without re-scanning the volume (meshing, physics broadphase)
+// =============================================================================
+struct ChunkOccupancySummary {
+    static constexpr std::uint32_t REGION_SIZE = 16;
+    static constexpr std::uint32_t REGIONS_PER_AXIS = CHUNK_SIZE_X / REGION_SIZE; // 4
+    static constexpr std::uint32_t REGION_COUNT =
+        REGIONS_PER_AXIS * REGIONS_PER_AXIS * REGIONS_PER_AXIS;                   // 64
+    static constexpr std::uint32_t REGION_VOLUME =
+        REGION_SIZE * REGION_SIZE * REGION_SIZE;                                  // 4096
+
+    // Indexed (rx * 4 + rz) * 4 + ry, matching chunk storage order
+    std::array<std::uint16_t, REGION_COUNT> solid{};
+
+    [[nodiscard]] std::uint16_t at(std::uint32_t rx, std::uint32_t ry, std::uint32_t rz) const noexcept {
+        return solid[(rx * REGIONS_PER_AXIS + rz) * REGIONS_PER_AXIS + ry];
+    }
+
+    [[nodiscard]] bool region_empty(std::uint32_t rx, std::uint32_t ry, std::uint32_t rz) const noexcept {
+        return at(rx, ry, rz) == 0;
+    }
+
+    [[nodiscard]] bool region_full(std::uint32_t rx, std::uint32_t ry, std::uint32_t rz) const noexcept {
+        return at(rx, ry, rz) == REGION_VOLUME;
+    }
+
+    // Whole-chunk answers from the 64 region counts (O(64))
+    [[nodiscard]] std::uint32_t total_solid() const noexcept {
+        std::uint32_t total = 0;
+        for (std::uint16_t count : solid) {
+            total += count;
+        }
+        return total;
+    }
+
+    [[nodiscard]] bool empty() const noexcept { return total_solid() == 0; }
+    [[nodiscard]] bool full() const noexcept { return total_solid() == CHUNK_VOLUME; }
+};
+
+// =============================================================================
+// CHUNK SOLIDITY MASK
+// 1 bit per voxel (32 KiB), set when the voxel is not air. Y is the
+// fastest-varying index axis, so each (x, z) column is exactly one 64-bit
+// word - an AABB's vertical span tests against a column with a single
+// word-wide AND. Built lazily by Chunk::solidity_column() and kept
+// current by Chunk::set(); UNIFORM/NONE tiers answer without ever
+// materializing it.
+// =============================================================================
+struct ChunkSolidityMask {
+    static constexpr std::uint32_t WORD_COUNT = CHUNK_VOLUME / 64; // 4096
+
+    // Indexed (x << 6) | z; bit y of a word covers local (x, y, z)
+    std::array<std::uint64_t, WORD_COUNT> words{};
+};
+
 // =============================================================================
 // CHUNK: Primary voxel storage container
 // - 64-byte alignment for cache line optimization
 // - Flat 1D array for maximum cache locality
 // - Column-major ordering (Y varies fastest) for vertical access patterns
+//
+// Storage tiers (selected automatically from distinct block count):
+//   UNIFORM  - single voxel value, zero heap allocation (all-air, all-stone)
+//   PACKED4  - <=16 distinct values, 4-bit indices into palette (128 KiB)
+//   PACKED8  - <=256 distinct values, 8-bit indices into palette (256 KiB)
+//   DENSE    - raw flat Voxel array (1 MiB), required for data()/raw_data()
+//
+// get()/set() stay inlined hot paths in every tier. data()/raw_data()
+// transparently promote to DENSE so flat-view consumers (MeshGenerator,
+// serialization, SIMD kernels) are unaffected. Call compress() after bulk
+// writes to re-select the smallest tier.
 // =============================================================================
 class alignas(64) Chunk {
 public:
@@ -29,9 +107,17 @@ public:
     static constexpr std::uint32_t SIZE_Z = CHUNK_SIZE_Z;
     static constexpr std::uint32_t VOLUME = CHUNK_VOLUME; // 64^3 = 262,144
 
-    // Memory footprint: 262,144 voxels * 4 bytes = 1,048,576 bytes (1 MiB)
+    // Memory footprint of the dense tier: 262,144 voxels * 4 bytes = 1 MiB
     static constexpr std::size_t DATA_SIZE_BYTES = VOLUME * sizeof(Voxel);
 
+    // Packed tier sizes
+    static constexpr std::size_t PACKED4_SIZE_BYTES = VOLUME / 2; // 2 voxels per byte
+    static constexpr std::size_t PACKED8_SIZE_BYTES = VOLUME;     // 1 voxel per byte
+
+    // Palette capacities per tier
+    static constexpr std::size_t PALETTE4_CAPACITY = 16;
+    static constexpr std::size_t PALETTE8_CAPACITY = 256;
+
     // =============================================================================
     // CHUNK STATE FLAGS
     // =============================================================================
@@ -45,17 +131,57 @@ public:
         UNLOADING   = 6     // Scheduled for unload
     };
 
+    // =============================================================================
+    // STORAGE TIERS
+    // =============================================================================
+    enum class Storage : std::uint8_t {
+        NONE     = 0,   // Unloaded, no backing storage
+        UNIFORM  = 1,   // Single value, no allocation
+        PACKED4  = 2,   // 4-bit palette indices
+        PACKED8  = 3,   // 8-bit palette indices
+        DENSE    = 4    // Flat Voxel array
+    };
+
 private:
-    // Voxel data - 64-byte aligned unique_ptr with custom deleter
+    // Aligned unique_ptr deleters (64-byte alignment for SIMD access).
+    // Dense voxel buffers recycle through the global pool; packed-index
+    // buffers are small and varied enough to stay on plain allocation.
     struct AlignedDeleter {
         void operator()(Voxel* ptr) const noexcept {
+            if (ptr) {
+                memory::chunk_buffer_pool().release(ptr);
+            }
+        }
+    };
+
+    struct AlignedByteDeleter {
+        void operator()(std::uint8_t* ptr) const noexcept {
             if (ptr) {
                 ::operator delete[](ptr, std::align_val_t{64});
             }
         }
     };
-    
-    std::unique_ptr<Voxel[], AlignedDeleter> m_voxels;
+
+    // Storage tier selector. Mutable: data()/raw_data() promote to DENSE on
+    // logically-const chunks (the voxel contents are unchanged by promotion).
+    mutable Storage m_storage;
+
+    // Cached immutable snapshot for background consumers (mesh workers).
+    // Snapshots own their buffer, so chunk writes never race a reader -
+    // a write just drops the cache and the next snapshot() rebuilds it.
+    mutable std::shared_ptr<const Voxel[]> m_snapshot;
+
+    // UNIFORM tier value (also palette entry 0 before first promotion)
+    Voxel m_uniform;
+
+    // Dense voxel data - 64-byte aligned (DENSE tier only)
+    mutable std::unique_ptr<Voxel[], AlignedDeleter> m_voxels;
+
+    // Packed palette indices (PACKED4/PACKED8 tiers)
+    mutable std::unique_ptr<std::uint8_t[], AlignedByteDeleter> m_packed;
+
+    // Palette for packed tiers (index -> voxel value)
+    mutable std::vector<Voxel> m_palette;
 
     // Chunk world position
     ChunkPosition m_position;
@@ -66,35 +192,56 @@ private:
     // Dirty region tracking (optimization for partial mesh updates)
     bool m_fully_dirty;
 
+    // Bit per 16^3 region written since the last clear_dirty(), same
+    // bit layout as ChunkOccupancySummary. Single-voxel writes set one
+    // bit; bulk paths flood the mask.
+    std::uint64_t m_dirty_regions;
+
+    // World access-clock stamp for LRU eviction. Atomic (relaxed)
+    // because readers stamp it while holding only a shared shard lock;
+    // mutable because lookups through const chunks count as use.
+    mutable std::atomic<std::uint64_t> m_last_access{0};
+
+    // Lazily built solidity bitmask (collision broadphase). Kept current
+    // by set(); dropped on bulk rewrites and mutable raw-data access.
+    mutable std::unique_ptr<ChunkSolidityMask> m_solidity;
+
+    // Lazily built per-16^3-region occupancy counts (scan skipping).
+    // Same lifecycle as the solidity mask: set() keeps it current,
+    // bulk rewrites drop it.
+    mutable std::unique_ptr<ChunkOccupancySummary> m_occupancy;
+
 public:
     // =============================================================================
     // CONSTRUCTION / DESTRUCTION
     // =============================================================================
-    
+
     // Default constructor - creates empty (air-filled) chunk
-    Chunk() 
-        : m_voxels(nullptr)
+    Chunk()
+        : m_storage(Storage::NONE)
+        , m_uniform{}
         , m_position{}
         , m_state(State::UNLOADED)
-        , m_fully_dirty(false) 
+        , m_fully_dirty(false)
+        , m_dirty_regions(0)
     {}
 
-    // Construct with position and allocate memory
+    // Construct with position - starts as uniform air (no heap allocation)
     explicit Chunk(ChunkPosition pos)
-        : m_voxels(allocate_voxels())
+        : m_storage(Storage::UNIFORM)
+        , m_uniform{}
         , m_position(pos)
         , m_state(State::LOADED)
         , m_fully_dirty(true)
-    {
-        // Zero-initialize all voxels (air) - use raw uint32_t pointer to avoid class-memaccess warning
-        std::memset(static_cast<void*>(m_voxels.get()), 0, DATA_SIZE_BYTES);
-    }
+        , m_dirty_regions(~std::uint64_t{0})
+    {}
 
-    // Move-only semantics (no copying 1 MiB chunks)
+    // Pinned in place (the access stamp is atomic and chunk storage is
+    // never copied); ownership moves through ChunkPtr instead
     Chunk(const Chunk&) = delete;
     Chunk& operator=(const Chunk&) = delete;
-    Chunk(Chunk&&) noexcept = default;
-    Chunk& operator=(Chunk&&) noexcept = default;
+    Chunk(Chunk&&) = delete;
+    Chunk& operator=(Chunk&&) = delete;
 
     ~Chunk() = default;
 
@@ -104,24 +251,48 @@ public:
 
     // Get voxel at local coordinates (no bounds checking - hot path)
     [[nodiscard]] Voxel get(LocalCoord x, LocalCoord y, LocalCoord z) const noexcept {
-        return m_voxels[coord::to_index(x, y, z)];
+        return get(coord::to_index(x, y, z));
     }
 
     // Get voxel by flat index (no bounds checking - hot path)
     [[nodiscard]] Voxel get(VoxelIndex index) const noexcept {
-        return m_voxels[index];
+        switch (m_storage) {
+            case Storage::DENSE:
+                return m_voxels[index];
+            case Storage::PACKED8:
+                return m_palette[m_packed[index]];
+            case Storage::PACKED4:
+                return m_palette[(m_packed[index >> 1] >> ((index & 1u) << 2)) & 0x0Fu];
+            case Storage::UNIFORM:
+                return m_uniform;
+            case Storage::NONE:
+            default:
+                return Voxel{};
+        }
     }
 
     // Set voxel at local coordinates (no bounds checking - hot path)
     void set(LocalCoord x, LocalCoord y, LocalCoord z, Voxel voxel) noexcept {
-        m_voxels[coord::to_index(x, y, z)] = voxel;
-        mark_dirty();
+        set(coord::to_index(x, y, z), voxel);
     }
 
     // Set voxel by flat index (no bounds checking - hot path)
     void set(VoxelIndex index, Voxel voxel) noexcept {
-        m_voxels[index] = voxel;
-        mark_dirty();
+        if (m_storage == Storage::DENSE) {
+            if (m_occupancy) {
+                update_occupancy_count(index, m_voxels[index], voxel);
+            }
+            m_voxels[index] = voxel;
+            update_solidity_bit(index, voxel);
+            mark_dirty_region(index);
+            return;
+        }
+        if (m_occupancy) {
+            update_occupancy_count(index, get(index), voxel);
+        }
+        set_slow(index, voxel);
+        update_solidity_bit(index, voxel);
+        mark_dirty_region(index);
     }
 
     // Safe access with bounds checking
@@ -142,16 +313,140 @@ public:
 
     // =============================================================================
     // RAW DATA ACCESS (For serialization, mesh generation, SIMD operations)
+    // Lazily decompresses compressed tiers into the dense flat view
     // =============================================================================
 
-    [[nodiscard]] Voxel* data() noexcept { return m_voxels.get(); }
-    [[nodiscard]] const Voxel* data() const noexcept { return m_voxels.get(); }
+    [[nodiscard]] Voxel* data() noexcept {
+        promote_to_dense();
+        // Caller may write through this pointer
+        m_snapshot.reset();
+        m_solidity.reset();
+        m_occupancy.reset();
+        return m_voxels.get();
+    }
+    [[nodiscard]] const Voxel* data() const noexcept {
+        promote_to_dense();
+        return m_voxels.get();
+    }
 
-    [[nodiscard]] std::uint32_t* raw_data() noexcept { 
-        return reinterpret_cast<std::uint32_t*>(m_voxels.get()); 
+    // Dense view whose current contents the caller promises to fully
+    // overwrite (region loads, generators that write every voxel). Skips
+    // the decompress/zero step of data(): the returned buffer holds
+    // whatever the pool block held before.
+    [[nodiscard]] Voxel* data_for_overwrite() noexcept {
+        if (m_storage != Storage::DENSE) {
+            m_voxels.reset(allocate_voxels());
+            m_packed.reset();
+            m_palette.clear();
+            m_palette.shrink_to_fit();
+            m_storage = Storage::DENSE;
+        }
+        m_snapshot.reset();
+        m_solidity.reset();
+        m_occupancy.reset();
+        return m_voxels.get();
+    }
+
+    [[nodiscard]] std::uint32_t* raw_data() noexcept {
+        return reinterpret_cast<std::uint32_t*>(data());
     }
-    [[nodiscard]] const std::uint32_t* raw_data() const noexcept { 
-        return reinterpret_cast<const std::uint32_t*>(m_voxels.get()); 
+    [[nodiscard]] const std::uint32_t* raw_data() const noexcept {
+        return reinterpret_cast<const std::uint32_t*>(data());
+    }
+
+    // =============================================================================
+    // IMMUTABLE SNAPSHOTS (Zero-copy publication to background tasks)
+    // =============================================================================
+
+    // Dense immutable view of the chunk contents. Cached: repeated calls
+    // on an unmodified chunk only bump a refcount. A write to the chunk
+    // detaches the cache, so in-flight readers keep a consistent view and
+    // the next call pays a single rebuild.
+    [[nodiscard]] std::shared_ptr<const Voxel[]> snapshot() const {
+        if (m_snapshot) {
+            return m_snapshot;
+        }
+
+        std::shared_ptr<Voxel[]> copy(allocate_voxels(), AlignedDeleter{});
+        if (m_storage == Storage::DENSE) {
+            std::memcpy(copy.get(), m_voxels.get(), DATA_SIZE_BYTES);
+        } else {
+            for (VoxelIndex i = 0; i < VOLUME; ++i) {
+                copy[i] = get(i);
+            }
+        }
+        m_snapshot = std::move(copy);
+        return m_snapshot;
+    }
+
+    // =============================================================================
+    // STORAGE TIER MANAGEMENT
+    // =============================================================================
+
+    [[nodiscard]] Storage storage_mode() const noexcept { return m_storage; }
+
+    // Current resident storage footprint in bytes (excludes the Chunk object)
+    [[nodiscard]] std::size_t storage_bytes() const noexcept {
+        switch (m_storage) {
+            case Storage::DENSE:   return DATA_SIZE_BYTES;
+            case Storage::PACKED8: return PACKED8_SIZE_BYTES + m_palette.capacity() * sizeof(Voxel);
+            case Storage::PACKED4: return PACKED4_SIZE_BYTES + m_palette.capacity() * sizeof(Voxel);
+            case Storage::UNIFORM:
+            case Storage::NONE:
+            default:               return 0;
+        }
+    }
+
+    // Re-select the smallest tier that can represent the current contents.
+    // Call after bulk writes (world generation, deserialization); O(VOLUME).
+    void compress() {
+        if (m_storage == Storage::NONE || m_storage == Storage::UNIFORM) {
+            return;
+        }
+
+        // Count distinct values (bail to DENSE past PALETTE8_CAPACITY)
+        std::vector<Voxel> palette;
+        palette.reserve(PALETTE4_CAPACITY);
+        for (VoxelIndex i = 0; i < VOLUME; ++i) {
+            const Voxel v = get(i);
+            if (palette_index_of(palette, v) < 0) {
+                if (palette.size() >= PALETTE8_CAPACITY) {
+                    return; // Too many distinct values - stay dense
+                }
+                palette.push_back(v);
+            }
+        }
+
+        if (palette.size() == 1) {
+            m_uniform = palette[0];
+            m_voxels.reset();
+            m_packed.reset();
+            m_palette.clear();
+            m_palette.shrink_to_fit();
+            m_storage = Storage::UNIFORM;
+            return;
+        }
+
+        const bool use4 = (palette.size() <= PALETTE4_CAPACITY);
+        auto packed = std::unique_ptr<std::uint8_t[], AlignedByteDeleter>(
+            allocate_bytes(use4 ? PACKED4_SIZE_BYTES : PACKED8_SIZE_BYTES));
+
+        if (use4) {
+            std::memset(packed.get(), 0, PACKED4_SIZE_BYTES);
+            for (VoxelIndex i = 0; i < VOLUME; ++i) {
+                const auto idx = static_cast<std::uint8_t>(palette_index_of(palette, get(i)));
+                packed[i >> 1] |= static_cast<std::uint8_t>(idx << ((i & 1u) << 2));
+            }
+        } else {
+            for (VoxelIndex i = 0; i < VOLUME; ++i) {
+                packed[i] = static_cast<std::uint8_t>(palette_index_of(palette, get(i)));
+            }
+        }
+
+        m_voxels.reset();
+        m_packed = std::move(packed);
+        m_palette = std::move(palette);
+        m_storage = use4 ? Storage::PACKED4 : Storage::PACKED8;
     }
 
     // =============================================================================
@@ -161,16 +456,16 @@ public:
     [[nodiscard]] State state() const noexcept { return m_state; }
     void set_state(State state) noexcept { m_state = state; }
 
-    [[nodiscard]] bool is_loaded() const noexcept { 
-        return m_voxels != nullptr && m_state >= State::LOADED; 
+    [[nodiscard]] bool is_loaded() const noexcept {
+        return m_storage != Storage::NONE && m_state >= State::LOADED;
     }
 
-    [[nodiscard]] bool is_dirty() const noexcept { 
-        return m_state == State::DIRTY || m_fully_dirty; 
+    [[nodiscard]] bool is_dirty() const noexcept {
+        return m_state == State::DIRTY || m_fully_dirty;
     }
 
-    [[nodiscard]] bool is_ready() const noexcept { 
-        return m_state == State::READY; 
+    [[nodiscard]] bool is_ready() const noexcept {
+        return m_state == State::READY;
     }
 
     void mark_dirty() noexcept {
@@ -178,15 +473,56 @@ public:
             m_state = State::DIRTY;
         }
         m_fully_dirty = true;
+        m_dirty_regions = ~std::uint64_t{0};
+        // Contents changed - detach the cached snapshot
+        m_snapshot.reset();
     }
 
+    // Every 16^3 region on the chunk's outer shell. A chunk queued for
+    // remesh by a neighbor's border edit has unchanged contents (its own
+    // mask is empty) but stale boundary-face visibility; remeshing the
+    // shell regions covers it.
+    static constexpr std::uint64_t BOUNDARY_REGIONS = []() {
+        std::uint64_t mask = 0;
+        for (std::uint32_t rx = 0; rx < 4; ++rx) {
+            for (std::uint32_t rz = 0; rz < 4; ++rz) {
+                for (std::uint32_t ry = 0; ry < 4; ++ry) {
+                    if (rx == 0 || rx == 3 || ry == 0 || ry == 3 || rz == 0 || rz == 3) {
+                        mask |= std::uint64_t{1} << ((rx * 4 + rz) * 4 + ry);
+                    }
+                }
+            }
+        }
+        return mask;
+    }();
+
+    // Regions written since the last clear_dirty(). A partial remesh
+    // only needs to rebuild slices these regions touch; is_fully_dirty()
+    // distinguishes a flooded mask from 64 individual writes.
+    [[nodiscard]] std::uint64_t dirty_regions() const noexcept { return m_dirty_regions; }
+    [[nodiscard]] bool is_fully_dirty() const noexcept { return m_fully_dirty; }
+
     void clear_dirty() noexcept {
         m_fully_dirty = false;
+        m_dirty_regions = 0;
         if (m_state == State::DIRTY) {
             m_state = State::LOADED;
         }
     }
 
+    // =============================================================================
+    // ACCESS TRACKING (LRU eviction)
+    // =============================================================================
+
+    // Stamp the chunk with the world's current access tick
+    void touch(std::uint64_t tick) const noexcept {
+        m_last_access.store(tick, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] std::uint64_t last_access() const noexcept {
+        return m_last_access.load(std::memory_order_relaxed);
+    }
+
     // =============================================================================
     // POSITION
     // =============================================================================
@@ -198,38 +534,45 @@ public:
     // MEMORY MANAGEMENT
     // =============================================================================
 
-    // Allocate voxel storage (called on demand)
+    // Ensure the chunk has backing storage (uniform air - no allocation)
     void allocate() {
-        if (!m_voxels) {
-            m_voxels.reset(allocate_voxels());
-            std::memset(static_cast<void*>(m_voxels.get()), 0, DATA_SIZE_BYTES);
+        if (m_storage == Storage::NONE) {
+            m_uniform = Voxel{};
+            m_storage = Storage::UNIFORM;
             m_state = State::LOADED;
             m_fully_dirty = true;
         }
     }
 
-    // Release voxel storage (for unloading)
+    // Release all voxel storage (for unloading)
     void deallocate() noexcept {
         m_voxels.reset();
+        m_packed.reset();
+        m_palette.clear();
+        m_palette.shrink_to_fit();
+        m_storage = Storage::NONE;
         m_state = State::UNLOADED;
         m_fully_dirty = false;
+        m_snapshot.reset();
+        m_solidity.reset();
+        m_occupancy.reset();
     }
 
     // =============================================================================
     // BULK OPERATIONS
     // =============================================================================
 
-    // Fill entire chunk with a single voxel type
+    // Fill entire chunk with a single voxel type - collapses to UNIFORM tier
     void fill(Voxel voxel) noexcept {
-        if (!m_voxels) return;
-        
-        // Optimized fill using 32-bit writes
-        const std::uint32_t value = voxel.data;
-        std::uint32_t* ptr = raw_data();
-        
-        for (std::uint32_t i = 0; i < VOLUME; ++i) {
-            ptr[i] = value;
-        }
+        if (m_storage == Storage::NONE) return;
+
+        m_voxels.reset();
+        m_packed.reset();
+        m_palette.clear();
+        m_uniform = voxel;
+        m_storage = Storage::UNIFORM;
+        m_solidity.reset();   // UNIFORM answers solidity without the mask
+        m_occupancy.reset();  // ...and occupancy
         mark_dirty();
     }
 
@@ -237,7 +580,7 @@ public:
     void fill_region(LocalCoord x1, LocalCoord y1, LocalCoord z1,
                      LocalCoord x2, LocalCoord y2, LocalCoord z2,
                      Voxel voxel) noexcept {
-        if (!m_voxels) return;
+        if (m_storage == Storage::NONE) return;
 
         // Clamp to chunk bounds
         x1 = x1 < 0 ? 0 : (x1 >= static_cast<LocalCoord>(SIZE_X) ? SIZE_X - 1 : x1);
@@ -247,10 +590,19 @@ public:
         y2 = y2 < 0 ? 0 : (y2 >= static_cast<LocalCoord>(SIZE_Y) ? SIZE_Y - 1 : y2);
         z2 = z2 < 0 ? 0 : (z2 >= static_cast<LocalCoord>(SIZE_Z) ? SIZE_Z - 1 : z2);
 
+        // Full-chunk region collapses to the UNIFORM tier
+        if (x1 == 0 && y1 == 0 && z1 == 0 &&
+            x2 == static_cast<LocalCoord>(SIZE_X - 1) &&
+            y2 == static_cast<LocalCoord>(SIZE_Y - 1) &&
+            z2 == static_cast<LocalCoord>(SIZE_Z - 1)) {
+            fill(voxel);
+            return;
+        }
+
         for (LocalCoord x = x1; x <= x2; ++x) {
             for (LocalCoord z = z1; z <= z2; ++z) {
                 for (LocalCoord y = y1; y <= y2; ++y) {
-                    m_voxels[coord::to_index(x, y, z)] = voxel;
+                    set(coord::to_index(x, y, z), voxel);
                 }
             }
         }
@@ -259,13 +611,23 @@ public:
 
     // Count non-air voxels (for optimization decisions)
     [[nodiscard]] std::uint32_t count_solid() const noexcept {
-        if (!m_voxels) return 0;
-        
+        if (m_occupancy) {
+            return m_occupancy->total_solid();  // O(64)
+        }
+        switch (m_storage) {
+            case Storage::NONE:
+                return 0;
+            case Storage::UNIFORM:
+                return m_uniform.is_air() ? 0 : VOLUME;
+            case Storage::DENSE:
+                return VOLUME - count_air_dense(m_voxels.get(), VOLUME);
+            default:
+                break;
+        }
+
         std::uint32_t count = 0;
-        const Voxel* ptr = m_voxels.get();
-        
-        for (std::uint32_t i = 0; i < VOLUME; ++i) {
-            if (!ptr[i].is_air()) {
+        for (VoxelIndex i = 0; i < VOLUME; ++i) {
+            if (!get(i).is_air()) {
                 ++count;
             }
         }
@@ -274,11 +636,22 @@ public:
 
     // Check if chunk is entirely air (skip meshing)
     [[nodiscard]] bool is_empty() const noexcept {
-        if (!m_voxels) return true;
-        
-        const std::uint32_t* ptr = raw_data();
-        for (std::uint32_t i = 0; i < VOLUME; ++i) {
-            if ((ptr[i] & Voxel::TYPE_MASK) != 0) {
+        if (m_occupancy) {
+            return m_occupancy->empty();  // O(64)
+        }
+        switch (m_storage) {
+            case Storage::NONE:
+                return true;
+            case Storage::UNIFORM:
+                return m_uniform.type_id() == 0;
+            case Storage::DENSE:
+                return all_air_dense(m_voxels.get());
+            default:
+                break;
+        }
+
+        for (VoxelIndex i = 0; i < VOLUME; ++i) {
+            if (get(i).type_id() != 0) {
                 return false;
             }
         }
@@ -287,22 +660,461 @@ public:
 
     // Check if chunk is entirely solid (optimize face culling)
     [[nodiscard]] bool is_full() const noexcept {
-        if (!m_voxels) return false;
-        
-        const std::uint32_t* ptr = raw_data();
-        for (std::uint32_t i = 0; i < VOLUME; ++i) {
-            if ((ptr[i] & Voxel::TYPE_MASK) == 0) {
+        if (m_occupancy) {
+            return m_occupancy->full();  // O(64)
+        }
+        switch (m_storage) {
+            case Storage::NONE:
+                return false;
+            case Storage::UNIFORM:
+                return m_uniform.type_id() != 0;
+            case Storage::DENSE:
+                return none_air_dense(m_voxels.get());
+            default:
+                break;
+        }
+
+        for (VoxelIndex i = 0; i < VOLUME; ++i) {
+            if (get(i).type_id() == 0) {
                 return false;
             }
         }
         return true;
     }
 
+    // Solid counts per 16^3 sub-region. One pass over the volume; the
+    // dense tier scans 16-voxel runs with the vector kernel (each run is
+    // a contiguous, 64-byte aligned Y span). Packed tiers take the
+    // scalar path rather than paying a dense promotion.
+    [[nodiscard]] ChunkOccupancySummary compute_occupancy_summary() const noexcept {
+        ChunkOccupancySummary summary{};
+        switch (m_storage) {
+            case Storage::NONE:
+                return summary;
+            case Storage::UNIFORM:
+                if (!m_uniform.is_air()) {
+                    summary.solid.fill(ChunkOccupancySummary::REGION_VOLUME);
+                }
+                return summary;
+            default:
+                break;
+        }
+
+        constexpr std::uint32_t REGION = ChunkOccupancySummary::REGION_SIZE;
+        constexpr std::uint32_t PER_AXIS = ChunkOccupancySummary::REGIONS_PER_AXIS;
+
+        if (m_storage == Storage::DENSE) {
+            for (std::uint32_t x = 0; x < SIZE_X; ++x) {
+                for (std::uint32_t z = 0; z < SIZE_Z; ++z) {
+                    const Voxel* column = m_voxels.get() + ((x << 12) | (z << 6));
+                    const std::uint32_t base = ((x / REGION) * PER_AXIS + (z / REGION)) * PER_AXIS;
+                    for (std::uint32_t ry = 0; ry < PER_AXIS; ++ry) {
+                        const std::uint32_t run_solid =
+                            REGION - count_air_dense(column + ry * REGION, REGION);
+                        summary.solid[base + ry] =
+                            static_cast<std::uint16_t>(summary.solid[base + ry] + run_solid);
+                    }
+                }
+            }
+            return summary;
+        }
+
+        for (VoxelIndex i = 0; i < VOLUME; ++i) {
+            if (get(i).is_air()) {
+                continue;
+            }
+            const std::uint32_t x = i >> 12;
+            const std::uint32_t z = (i >> 6) & 63u;
+            const std::uint32_t y = i & 63u;
+            const std::uint32_t region =
+                ((x / REGION) * PER_AXIS + (z / REGION)) * PER_AXIS + (y / REGION);
+            summary.solid[region] = static_cast<std::uint16_t>(summary.solid[region] + 1u);
+        }
+        return summary;
+    }
+
+    // Maintained occupancy hierarchy: built once from the volume, then
+    // kept current bit-by-bit in set(). While resident, is_empty/is_full/
+    // count_solid answer from the 64 region counts instead of scanning
+    // 262144 voxels, and the mesher skips provably-all-air 16^3 cells.
+    [[nodiscard]] const ChunkOccupancySummary& occupancy() const noexcept {
+        if (!m_occupancy) {
+            m_occupancy = std::make_unique<ChunkOccupancySummary>(compute_occupancy_summary());
+        }
+        return *m_occupancy;
+    }
+
+    // =============================================================================
+    // SOLIDITY BITMASK (Collision broadphase)
+    // =============================================================================
+
+    // Solidity word for local column (x, z): bit y set when (x, y, z) is
+    // not air. UNIFORM/NONE tiers answer without materializing the mask;
+    // other tiers build it lazily on first query, after which set() keeps
+    // it current bit-by-bit.
+    [[nodiscard]] std::uint64_t solidity_column(LocalCoord x, LocalCoord z) const noexcept {
+        switch (m_storage) {
+            case Storage::NONE:
+                return 0;
+            case Storage::UNIFORM:
+                return m_uniform.is_air() ? 0 : ~std::uint64_t{0};
+            default:
+                break;
+        }
+        if (!m_solidity) {
+            build_solidity();
+        }
+        return m_solidity->words[(static_cast<std::uint32_t>(x) << 6)
+                                 | static_cast<std::uint32_t>(z)];
+    }
+
 private:
-    // Allocate 64-byte aligned voxel array
+    // =============================================================================
+    // TIER PROMOTION (Cold Paths)
+    // =============================================================================
+
+    // Palette lookup (palettes are tiny - linear scan beats hashing here)
+    [[nodiscard]] static std::int32_t palette_index_of(
+        const std::vector<Voxel>& palette, Voxel v) noexcept {
+        for (std::size_t i = 0; i < palette.size(); ++i) {
+            if (palette[i] == v) {
+                return static_cast<std::int32_t>(i);
+            }
+        }
+        return -1;
+    }
+
+    // 16^3 region containing a voxel index (ChunkOccupancySummary layout)
+    [[nodiscard]] static std::uint32_t region_of(VoxelIndex index) noexcept {
+        constexpr std::uint32_t REGION = ChunkOccupancySummary::REGION_SIZE;
+        constexpr std::uint32_t PER_AXIS = ChunkOccupancySummary::REGIONS_PER_AXIS;
+        const std::uint32_t x = index >> 12;
+        const std::uint32_t z = (index >> 6) & 63u;
+        const std::uint32_t y = index & 63u;
+        return ((x / REGION) * PER_AXIS + (z / REGION)) * PER_AXIS + (y / REGION);
+    }
+
+    // Single-voxel variant of mark_dirty: dirties only the touched
+    // region so the next remesh can be partial
+    void mark_dirty_region(VoxelIndex index) noexcept {
+        if (m_state == State::LOADED || m_state == State::READY) {
+            m_state = State::DIRTY;
+        }
+        m_dirty_regions |= std::uint64_t{1} << region_of(index);
+        m_snapshot.reset();
+    }
+
+    // Keep the occupancy counts current across a single-voxel write
+    // (caller checks m_occupancy; old_voxel is read before the write)
+    void update_occupancy_count(VoxelIndex index, Voxel old_voxel, Voxel new_voxel) noexcept {
+        const bool was_solid = !old_voxel.is_air();
+        const bool now_solid = !new_voxel.is_air();
+        if (was_solid == now_solid) {
+            return;
+        }
+        const std::uint32_t region = region_of(index);
+        m_occupancy->solid[region] = static_cast<std::uint16_t>(
+            m_occupancy->solid[region] + (now_solid ? 1 : -1));
+    }
+
+    // Keep the solidity mask current across a single-voxel write
+    void update_solidity_bit(VoxelIndex index, Voxel voxel) noexcept {
+        if (!m_solidity) {
+            return;
+        }
+        std::uint64_t& word = m_solidity->words[index >> 6];
+        const std::uint64_t bit = std::uint64_t{1} << (index & 63u);
+        if (voxel.is_air()) {
+            word &= ~bit;
+        } else {
+            word |= bit;
+        }
+    }
+
+    // Materialize the solidity mask from the current storage tier
+    void build_solidity() const noexcept {
+        m_solidity = std::make_unique<ChunkSolidityMask>();
+        if (m_storage == Storage::DENSE) {
+            const Voxel* voxels = m_voxels.get();
+            for (std::uint32_t w = 0; w < ChunkSolidityMask::WORD_COUNT; ++w) {
+                const Voxel* column = voxels + (w << 6);
+                std::uint64_t bits = 0;
+                for (std::uint32_t b = 0; b < 64; ++b) {
+                    bits |= std::uint64_t{!column[b].is_air()} << b;
+                }
+                m_solidity->words[w] = bits;
+            }
+            return;
+        }
+        for (std::uint32_t w = 0; w < ChunkSolidityMask::WORD_COUNT; ++w) {
+            std::uint64_t bits = 0;
+            for (std::uint32_t b = 0; b < 64; ++b) {
+                bits |= std::uint64_t{!get((w << 6) | b).is_air()} << b;
+            }
+            m_solidity->words[w] = bits;
+        }
+    }
+
+    // Non-dense set path: write palette index, promoting tiers as needed
+    void set_slow(VoxelIndex index, Voxel voxel) noexcept {
+        switch (m_storage) {
+            case Storage::NONE:
+                allocate();
+                [[fallthrough]];
+            case Storage::UNIFORM: {
+                if (voxel == m_uniform) {
+                    return;
+                }
+                promote_uniform_to_packed4();
+                break;
+            }
+            default:
+                break;
+        }
+
+        std::int32_t idx = palette_index_of(m_palette, voxel);
+        if (idx < 0) {
+            const std::size_t capacity =
+                (m_storage == Storage::PACKED4) ? PALETTE4_CAPACITY : PALETTE8_CAPACITY;
+            if (m_palette.size() >= capacity) {
+                if (m_storage == Storage::PACKED4) {
+                    promote_packed4_to_packed8();
+                } else {
+                    promote_to_dense();
+                    m_voxels[index] = voxel;
+                    return;
+                }
+            }
+            idx = static_cast<std::int32_t>(m_palette.size());
+            m_palette.push_back(voxel);
+        }
+
+        const auto byte_idx = static_cast<std::uint8_t>(idx);
+        if (m_storage == Storage::PACKED4) {
+            const std::uint32_t shift = (index & 1u) << 2;
+            std::uint8_t& b = m_packed[index >> 1];
+            b = static_cast<std::uint8_t>(
+                (b & static_cast<std::uint8_t>(~(0x0Fu << shift))) |
+                static_cast<std::uint8_t>(byte_idx << shift));
+        } else {
+            m_packed[index] = byte_idx;
+        }
+    }
+
+    void promote_uniform_to_packed4() noexcept {
+        m_packed.reset(allocate_bytes(PACKED4_SIZE_BYTES));
+        std::memset(m_packed.get(), 0, PACKED4_SIZE_BYTES);
+        m_palette.clear();
+        m_palette.reserve(PALETTE4_CAPACITY);
+        m_palette.push_back(m_uniform);
+        m_storage = Storage::PACKED4;
+    }
+
+    void promote_packed4_to_packed8() noexcept {
+        auto wide = std::unique_ptr<std::uint8_t[], AlignedByteDeleter>(
+            allocate_bytes(PACKED8_SIZE_BYTES));
+        for (VoxelIndex i = 0; i < VOLUME; ++i) {
+            wide[i] = (m_packed[i >> 1] >> ((i & 1u) << 2)) & 0x0Fu;
+        }
+        m_packed = std::move(wide);
+        m_palette.reserve(PALETTE8_CAPACITY);
+        m_storage = Storage::PACKED8;
+    }
+
+    // Decompress the current tier into the dense flat array
+    void promote_to_dense() const noexcept {
+        if (m_storage == Storage::DENSE) {
+            return;
+        }
+
+        m_voxels.reset(allocate_voxels());
+        switch (m_storage) {
+            case Storage::NONE:
+            case Storage::UNIFORM: {
+                if (m_storage == Storage::NONE || m_uniform.data == 0) {
+                    std::memset(static_cast<void*>(m_voxels.get()), 0, DATA_SIZE_BYTES);
+                } else {
+                    splat_dense(m_voxels.get(), m_uniform);
+                }
+                break;
+            }
+            case Storage::PACKED4:
+                for (VoxelIndex i = 0; i < VOLUME; ++i) {
+                    m_voxels[i] = m_palette[(m_packed[i >> 1] >> ((i & 1u) << 2)) & 0x0Fu];
+                }
+                break;
+            case Storage::PACKED8:
+                for (VoxelIndex i = 0; i < VOLUME; ++i) {
+                    m_voxels[i] = m_palette[m_packed[i]];
+                }
+                break;
+            default:
+                break;
+        }
+
+        m_packed.reset();
+        m_palette.clear();
+        m_palette.shrink_to_fit();
+        m_storage = Storage::DENSE;
+    }
+
+    // =============================================================================
+    // BULK SCAN KERNELS (Dense tier)
+    // The dense array is 64-byte aligned exactly for these: AVX2 scans
+    // 8 voxels per compare with early exit per cache line, falling back
+    // to the scalar loop on targets without it. All kernels only read
+    // the type bits, so light and metadata never affect the results.
+    // =============================================================================
+
+    // Count air voxels in a contiguous span (span start must be 32-byte
+    // aligned; every 16-voxel Y run in the dense array qualifies)
+    [[nodiscard]] static std::uint32_t count_air_dense(const Voxel* voxels, std::uint32_t count) noexcept {
+#if defined(__AVX2__)
+        const __m256i type_mask = _mm256_set1_epi32(static_cast<std::int32_t>(Voxel::TYPE_MASK));
+        const __m256i zero = _mm256_setzero_si256();
+        __m256i acc = zero;
+        std::uint32_t i = 0;
+        for (; i + 8 <= count; i += 8) {
+            const __m256i v = _mm256_load_si256(reinterpret_cast<const __m256i*>(voxels + i));
+            // Air lanes compare to all-ones (-1); subtracting accumulates +1 each
+            acc = _mm256_sub_epi32(acc, _mm256_cmpeq_epi32(_mm256_and_si256(v, type_mask), zero));
+        }
+        alignas(32) std::uint32_t lanes[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+        std::uint32_t air = lanes[0] + lanes[1] + lanes[2] + lanes[3] +
+                            lanes[4] + lanes[5] + lanes[6] + lanes[7];
+        for (; i < count; ++i) {
+            air += voxels[i].is_air() ? 1u : 0u;
+        }
+        return air;
+#else
+        std::uint32_t air = 0;
+        for (std::uint32_t i = 0; i < count; ++i) {
+            air += voxels[i].is_air() ? 1u : 0u;
+        }
+        return air;
+#endif
+    }
+
+    // True when every voxel in the dense array is air
+    [[nodiscard]] static bool all_air_dense(const Voxel* voxels) noexcept {
+#if defined(__AVX2__)
+        const __m256i type_mask = _mm256_set1_epi32(static_cast<std::int32_t>(Voxel::TYPE_MASK));
+        for (std::uint32_t i = 0; i < VOLUME; i += 32) {
+            // OR one 128-byte block, then a single zero test
+            __m256i acc = _mm256_load_si256(reinterpret_cast<const __m256i*>(voxels + i));
+            acc = _mm256_or_si256(acc, _mm256_load_si256(reinterpret_cast<const __m256i*>(voxels + i + 8)));
+            acc = _mm256_or_si256(acc, _mm256_load_si256(reinterpret_cast<const __m256i*>(voxels + i + 16)));
+            acc = _mm256_or_si256(acc, _mm256_load_si256(reinterpret_cast<const __m256i*>(voxels + i + 24)));
+            if (!_mm256_testz_si256(acc, type_mask)) {
+                return false;
+            }
+        }
+        return true;
+#else
+        for (VoxelIndex i = 0; i < VOLUME; ++i) {
+            if (!voxels[i].is_air()) {
+                return false;
+            }
+        }
+        return true;
+#endif
+    }
+
+    // True when no voxel in the dense array is air
+    [[nodiscard]] static bool none_air_dense(const Voxel* voxels) noexcept {
+#if defined(__AVX2__)
+        const __m256i type_mask = _mm256_set1_epi32(static_cast<std::int32_t>(Voxel::TYPE_MASK));
+        const __m256i zero = _mm256_setzero_si256();
+        for (std::uint32_t i = 0; i < VOLUME; i += 8) {
+            const __m256i v = _mm256_load_si256(reinterpret_cast<const __m256i*>(voxels + i));
+            const __m256i air = _mm256_cmpeq_epi32(_mm256_and_si256(v, type_mask), zero);
+            if (_mm256_movemask_epi8(air) != 0) {
+                return false;
+            }
+        }
+        return true;
+#else
+        for (VoxelIndex i = 0; i < VOLUME; ++i) {
+            if (voxels[i].is_air()) {
+                return false;
+            }
+        }
+        return true;
+#endif
+    }
+
+    // Splat one voxel value across the dense array. Streaming stores:
+    // the freshly promoted buffer is not read back immediately, so
+    // there is no point pulling 1 MiB through the cache to write it.
+    static void splat_dense(Voxel* voxels, Voxel value) noexcept {
+#if defined(__AVX2__)
+        const __m256i v = _mm256_set1_epi32(static_cast<std::int32_t>(value.data));
+        for (std::uint32_t i = 0; i < VOLUME; i += 8) {
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(voxels + i), v);
+        }
+        _mm_sfence();
+#else
+        for (VoxelIndex i = 0; i < VOLUME; ++i) {
+            voxels[i] = value;
+        }
+#endif
+    }
+
+    // Acquire a 64-byte aligned voxel array from the recycling pool.
+    // Contents are whatever the previous owner left: every caller either
+    // zeroes, splats, or decompresses over the full volume.
     [[nodiscard]] static Voxel* allocate_voxels() {
-        void* ptr = ::operator new[](DATA_SIZE_BYTES, std::align_val_t{64});
-        return static_cast<Voxel*>(ptr);
+        static_assert(DATA_SIZE_BYTES == memory::ChunkBufferPool::BLOCK_SIZE);
+        return static_cast<Voxel*>(memory::chunk_buffer_pool().acquire());
+    }
+
+    // Allocate 64-byte aligned byte array for packed indices
+    [[nodiscard]] static std::uint8_t* allocate_bytes(std::size_t size) {
+        void* ptr = ::operator new[](size, std::align_val_t{64});
+        return static_cast<std::uint8_t*>(ptr);
+    }
+};
+
+// =============================================================================
+// PADDED CHUNK SNAPSHOT
+// Immutable capture of a chunk plus the six adjacent boundary planes,
+// taken in one pass so mesh workers never call back into the world.
+// The center reuses Chunk::snapshot() (refcount bump when clean); each
+// neighbor contributes one copied 64x64 plane (16 KiB, empty = unloaded).
+// =============================================================================
+struct PaddedChunkSnapshot {
+    static constexpr std::uint32_t PLANE_SIZE = CHUNK_SIZE_X * CHUNK_SIZE_Z;
+
+    ChunkPosition position;
+    std::shared_ptr<const Voxel[]> center;
+
+    // Boundary planes from the six neighbors, indexed by face direction
+    // (-X, +X, -Y, +Y, -Z, +Z). X planes index [y*64+z], Y planes
+    // [x*64+z], Z planes [x*64+y]. Empty vector = neighbor not loaded.
+    std::array<std::vector<Voxel>, 6> planes;
+
+    // Sample in local coordinates extended by one voxel on each side
+    // (-1..64). Exactly one coordinate may be out of [0, 64); positions
+    // past an unloaded neighbor read as air.
+    [[nodiscard]] Voxel sample(LocalCoord x, LocalCoord y, LocalCoord z) const {
+        if (coord::is_valid_local(x, y, z)) {
+            return center[coord::to_index(x, y, z)];
+        }
+        std::size_t face;
+        std::size_t index;
+        if (x < 0 || x >= static_cast<LocalCoord>(CHUNK_SIZE_X)) {
+            face = (x < 0) ? 0 : 1;
+            index = static_cast<std::size_t>(y) * CHUNK_SIZE_X + static_cast<std::size_t>(z);
+        } else if (y < 0 || y >= static_cast<LocalCoord>(CHUNK_SIZE_Y)) {
+            face = (y < 0) ? 2 : 3;
+            index = static_cast<std::size_t>(x) * CHUNK_SIZE_X + static_cast<std::size_t>(z);
+        } else {
+            face = (z < 0) ? 4 : 5;
+            index = static_cast<std::size_t>(x) * CHUNK_SIZE_X + static_cast<std::size_t>(y);
+        }
+        const std::vector<Voxel>& plane = planes[face];
+        return plane.empty() ? Voxel{} : plane[index];
     }
 };
 
@@ -0,0 +1,201 @@
+// =============================================================================
+// VOXEL ENGINE - CHUNK SERIALIZATION CODEC
+// Compact palette + run-length encoding of a chunk's voxel volume, shared
+// by the region-file format and (eventually) network replication once the
+// server moves out of process. Terrain is dominated by long vertical runs
+// in the Y-fastest order coord::to_index produces, so typical chunks
+// shrink from the raw 1 MiB dense array to a few KiB.
+//
+// Wire format (little-endian, matching the rest of the on-disk structs):
+//   u8  version        CODEC_VERSION
+//   u8  reserved       0
+//   u16 palette_count  distinct raw voxel values
+//   u32 palette[palette_count]
+//   runs until the full volume is covered:
+//     varint palette_index   (LEB128)
+//     varint run_length      (LEB128, >= 1)
+// =============================================================================
+#pragma once
+
+#include "Shared/Types.hpp"
+#include "Shared/Chunk.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace voxel::chunk_codec {
+
+inline constexpr std::uint8_t CODEC_VERSION = 1;
+
+// Palette indices are stored as u16; a volume with more distinct values
+// than this (pathological noise) is not encodable and the caller should
+// fall back to the raw dense representation
+inline constexpr std::size_t MAX_PALETTE = 65535;
+
+namespace detail {
+
+// LEB128: 7 value bits per byte, high bit marks continuation
+inline void write_varint(std::vector<std::uint8_t>& out, std::uint32_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<std::uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<std::uint8_t>(value));
+}
+
+// Returns false on truncated or over-long input
+inline bool read_varint(const std::uint8_t*& cursor, const std::uint8_t* end, std::uint32_t& value) {
+    value = 0;
+    for (std::uint32_t shift = 0; shift < 35; shift += 7) {
+        if (cursor == end) {
+            return false;
+        }
+        const std::uint8_t byte = *cursor++;
+        value |= static_cast<std::uint32_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace detail
+
+// =============================================================================
+// ENCODE
+// =============================================================================
+
+// Encode a dense voxel volume (Chunk::raw_data layout, Chunk::VOLUME
+// entries). Single forward pass: runs and the palette are built
+// together, so the input is read exactly once at memory bandwidth.
+// Appends to out; returns false (out unchanged) on palette overflow.
+inline bool encode(const std::uint32_t* voxels, std::vector<std::uint8_t>& out) {
+    const std::size_t base = out.size();
+
+    // Header placeholder - palette_count is patched once known
+    out.push_back(CODEC_VERSION);
+    out.push_back(0);
+    out.push_back(0);
+    out.push_back(0);
+
+    std::unordered_map<std::uint32_t, std::uint32_t> palette_ids;
+    std::vector<std::uint32_t> palette;
+    std::vector<std::uint8_t> runs;
+    runs.reserve(512);
+
+    VoxelIndex i = 0;
+    while (i < Chunk::VOLUME) {
+        const std::uint32_t value = voxels[i];
+        VoxelIndex run = 1;
+        while (i + run < Chunk::VOLUME && voxels[i + run] == value) {
+            ++run;
+        }
+        i += run;
+
+        auto [it, inserted] = palette_ids.try_emplace(value, static_cast<std::uint32_t>(palette.size()));
+        if (inserted) {
+            if (palette.size() >= MAX_PALETTE) {
+                out.resize(base);
+                return false;
+            }
+            palette.push_back(value);
+        }
+        detail::write_varint(runs, it->second);
+        detail::write_varint(runs, run);
+    }
+
+    // Patch palette_count, then append palette and runs
+    const auto count = static_cast<std::uint16_t>(palette.size());
+    std::memcpy(out.data() + base + 2, &count, sizeof(count));
+    const std::size_t palette_bytes = palette.size() * sizeof(std::uint32_t);
+    out.resize(out.size() + palette_bytes);
+    std::memcpy(out.data() + base + 4, palette.data(), palette_bytes);
+    out.insert(out.end(), runs.begin(), runs.end());
+    return true;
+}
+
+// Encode a chunk. Uniform chunks never touch a dense buffer; packed
+// tiers are read out through get() so encoding never densifies the
+// chunk; a chunk already in the dense tier streams from raw_data().
+// Returns an empty vector on palette overflow.
+[[nodiscard]] inline std::vector<std::uint8_t> encode(const Chunk& chunk) {
+    std::vector<std::uint8_t> out;
+
+    if (chunk.storage_mode() == Chunk::Storage::DENSE) {
+        if (!encode(chunk.raw_data(), out)) {
+            out.clear();
+        }
+        return out;
+    }
+
+    // Scratch reused across calls on the same thread (writer thread,
+    // network send thread)
+    static thread_local std::vector<std::uint32_t> scratch;
+    scratch.resize(Chunk::VOLUME);
+    for (VoxelIndex i = 0; i < Chunk::VOLUME; ++i) {
+        scratch[i] = chunk.get(i).data;
+    }
+    if (!encode(scratch.data(), out)) {
+        out.clear();
+    }
+    return out;
+}
+
+// =============================================================================
+// DECODE
+// =============================================================================
+
+// Decode an encoded record into the chunk, overwriting its contents and
+// settling it into the smallest storage tier. Returns false (chunk
+// contents unspecified) on a malformed record: bad version, palette
+// index out of range, or runs not covering exactly the full volume.
+inline bool decode(std::span<const std::uint8_t> data, Chunk& chunk) {
+    const std::uint8_t* cursor = data.data();
+    const std::uint8_t* const end = cursor + data.size();
+
+    if (data.size() < 4 || cursor[0] != CODEC_VERSION) {
+        return false;
+    }
+    std::uint16_t palette_count = 0;
+    std::memcpy(&palette_count, cursor + 2, sizeof(palette_count));
+    cursor += 4;
+
+    if (static_cast<std::size_t>(end - cursor) < palette_count * sizeof(std::uint32_t)) {
+        return false;
+    }
+    const std::uint8_t* const palette = cursor;
+    cursor += palette_count * sizeof(std::uint32_t);
+
+    chunk.allocate();
+    std::uint32_t* voxels = reinterpret_cast<std::uint32_t*>(chunk.data_for_overwrite());
+
+    VoxelIndex filled = 0;
+    while (filled < Chunk::VOLUME) {
+        std::uint32_t index = 0;
+        std::uint32_t run = 0;
+        if (!detail::read_varint(cursor, end, index) ||
+            !detail::read_varint(cursor, end, run)) {
+            return false;
+        }
+        if (index >= palette_count || run == 0 || run > Chunk::VOLUME - filled) {
+            return false;
+        }
+        std::uint32_t value = 0;
+        std::memcpy(&value, palette + index * sizeof(std::uint32_t), sizeof(value));
+        for (VoxelIndex v = 0; v < run; ++v) {
+            voxels[filled + v] = value;
+        }
+        filled += run;
+    }
+    if (cursor != end) {
+        return false; // Trailing garbage - treat the record as corrupt
+    }
+
+    chunk.compress();
+    return true;
+}
+
+} // namespace voxel::chunk_codec
@@ -6,6 +6,8 @@
 
 #include "Shared/Types.hpp"
 #include "Shared/BlockRegistry.hpp"
+#include "Shared/Chunk.hpp"
+#include <bit>
 #include <cmath>
 #include <algorithm>
 
@@ -111,6 +113,91 @@ public:
         return false;
     }
 
+    // =============================================================================
+    // SOLIDITY-BITMASK BROADPHASE
+    // Chunk::solidity_column packs each (x, z) voxel column into one
+    // 64-bit word (bit y = solid), so the entity's vertical span tests
+    // against a whole column with a single AND. Full Voxel data (and the
+    // BlockRegistry collision check) is only fetched for set bits, and
+    // open air never touches voxel storage at all.
+    // =============================================================================
+
+    // Callback type: (ChunkCoord cx, cy, cz) -> const Chunk* (nullptr = air)
+    template<typename GetChunkFn>
+    static bool would_collide_cached(
+        double x, double y, double z,
+        double half_width, double half_height,
+        GetChunkFn&& get_chunk
+    ) {
+        AABB entity = AABB::from_center(x, y + half_height, z, half_width, half_height, half_width);
+
+        const std::int64_t min_bx = static_cast<std::int64_t>(std::floor(entity.min_x));
+        const std::int64_t max_bx = static_cast<std::int64_t>(std::floor(entity.max_x));
+        const std::int64_t min_by = static_cast<std::int64_t>(std::floor(entity.min_y));
+        const std::int64_t max_by = static_cast<std::int64_t>(std::floor(entity.max_y));
+        const std::int64_t min_bz = static_cast<std::int64_t>(std::floor(entity.min_z));
+        const std::int64_t max_bz = static_cast<std::int64_t>(std::floor(entity.max_z));
+
+        // Chunk resolved for the column most recently sampled
+        const Chunk* chunk = nullptr;
+        ChunkCoord chunk_x = 0, chunk_y = 0, chunk_z = 0;
+        bool chunk_valid = false;
+
+        for (std::int64_t bx = min_bx; bx <= max_bx; ++bx) {
+            for (std::int64_t bz = min_bz; bz <= max_bz; ++bz) {
+                const ChunkCoord cx = coord::world_to_chunk(bx);
+                const ChunkCoord cz = coord::world_to_chunk(bz);
+                const LocalCoord lx = coord::world_to_local(bx);
+                const LocalCoord lz = coord::world_to_local(bz);
+
+                // The vertical span covers at most two chunks for entity-
+                // sized AABBs; walk whichever it crosses
+                for (ChunkCoord cy = coord::world_to_chunk(min_by);
+                     cy <= coord::world_to_chunk(max_by); ++cy) {
+                    if (!chunk_valid || cx != chunk_x || cy != chunk_y || cz != chunk_z) {
+                        chunk = get_chunk(cx, cy, cz);
+                        chunk_x = cx;
+                        chunk_y = cy;
+                        chunk_z = cz;
+                        chunk_valid = true;
+                    }
+                    if (!chunk) {
+                        continue;  // Unloaded chunk reads as air
+                    }
+
+                    // Mask of local-Y bits inside [min_by, max_by]
+                    const ChunkCoord base_y = coord::chunk_to_world(cy);
+                    const std::uint64_t lo = static_cast<std::uint64_t>(
+                        std::max<ChunkCoord>(min_by - base_y, 0));
+                    const std::uint64_t hi = static_cast<std::uint64_t>(
+                        std::min<ChunkCoord>(max_by - base_y, 63));
+                    const std::uint64_t span =
+                        (hi == 63 ? ~std::uint64_t{0} : ((std::uint64_t{1} << (hi + 1)) - 1))
+                        & ~((std::uint64_t{1} << lo) - 1);
+
+                    std::uint64_t hits = chunk->solidity_column(lx, lz) & span;
+                    while (hits != 0) {
+                        const int ly = std::countr_zero(hits);
+                        hits &= hits - 1;
+
+                        // Narrow phase: fluids/non-solid blocks pass through
+                        const Voxel voxel = chunk->get(lx, static_cast<LocalCoord>(ly), lz);
+                        if (!BlockRegistry::instance().has_collision(voxel.type_id())) {
+                            continue;
+                        }
+
+                        const AABB block = AABB::from_block(bx, base_y + ly, bz);
+                        if (entity.intersects(block)) {
+                            return true;
+                        }
+                    }
+                }
+            }
+        }
+
+        return false;
+    }
+
     // Move entity with collision detection (axis-by-axis resolution for sliding)
     // Returns the actual position after collision
     template<typename GetVoxelFn>
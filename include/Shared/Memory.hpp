@@ -4,6 +4,7 @@
 // =============================================================================
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -119,6 +120,111 @@ template<typename T>
     return AlignedArrayUniquePtr<T>(static_cast<T*>(mem));
 }
 
+// =============================================================================
+// CHUNK BUFFER POOL
+// Lock-free free list of fixed-size 64-byte-aligned 1 MiB blocks (the
+// dense chunk voxel tier). Chunk churn at the view-distance edge would
+// otherwise be a steady stream of large OS allocations and page faults;
+// recycling keeps the hot blocks resident and already faulted in.
+// Treiber stack whose head packs the node pointer with a 16-bit
+// generation counter in the upper (non-canonical) address bits, so a
+// block popped and re-pushed between a reader's load and CAS cannot
+// ABA - and the whole head still fits one 64-bit CAS (no libatomic).
+// Blocks handed out carry arbitrary previous contents - callers that
+// need zeroed memory must clear it themselves.
+// =============================================================================
+class ChunkBufferPool {
+public:
+    static constexpr std::size_t BLOCK_SIZE = 1024 * 1024;
+    static constexpr std::size_t MAX_FREE_BLOCKS = 64;  // 64 MiB retained cap
+
+    ChunkBufferPool() = default;
+
+    ChunkBufferPool(const ChunkBufferPool&) = delete;
+    ChunkBufferPool& operator=(const ChunkBufferPool&) = delete;
+
+    ~ChunkBufferPool() {
+        FreeNode* node = head_node(m_head.load(std::memory_order_acquire));
+        while (node != nullptr) {
+            FreeNode* next = node->next;
+            ::operator delete[](static_cast<void*>(node), std::align_val_t{CACHE_LINE_SIZE});
+            node = next;
+        }
+    }
+
+    // Pop a recycled block, or fall back to a fresh OS allocation
+    [[nodiscard]] void* acquire() {
+        std::uint64_t head = m_head.load(std::memory_order_acquire);
+        while (head_node(head) != nullptr) {
+            FreeNode* node = head_node(head);
+            const std::uint64_t next = make_head(node->next, head_tag(head) + 1);
+            if (m_head.compare_exchange_weak(head, next,
+                                             std::memory_order_acquire,
+                                             std::memory_order_acquire)) {
+                m_free_count.fetch_sub(1, std::memory_order_relaxed);
+                return static_cast<void*>(node);
+            }
+        }
+        return ::operator new[](BLOCK_SIZE, std::align_val_t{CACHE_LINE_SIZE});
+    }
+
+    // Return a block to the free list; over-cap blocks go back to the OS
+    void release(void* block) noexcept {
+        if (block == nullptr) {
+            return;
+        }
+        if (m_free_count.load(std::memory_order_relaxed) >= MAX_FREE_BLOCKS) {
+            ::operator delete[](block, std::align_val_t{CACHE_LINE_SIZE});
+            return;
+        }
+        FreeNode* node = static_cast<FreeNode*>(block);
+        std::uint64_t head = m_head.load(std::memory_order_relaxed);
+        std::uint64_t next;
+        do {
+            node->next = head_node(head);
+            next = make_head(node, head_tag(head) + 1);
+        } while (!m_head.compare_exchange_weak(head, next,
+                                               std::memory_order_release,
+                                               std::memory_order_relaxed));
+        m_free_count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] std::size_t free_blocks() const noexcept {
+        return m_free_count.load(std::memory_order_relaxed);
+    }
+
+private:
+    // Free-list node stored in the first bytes of the block itself
+    struct FreeNode {
+        FreeNode* next;
+    };
+
+    // Packed head: bits 0-47 node pointer (canonical user-space address),
+    // bits 48-63 generation counter bumped on every successful CAS
+    static constexpr std::uint64_t PTR_MASK = (std::uint64_t{1} << 48) - 1;
+
+    [[nodiscard]] static FreeNode* head_node(std::uint64_t head) noexcept {
+        return reinterpret_cast<FreeNode*>(head & PTR_MASK);
+    }
+
+    [[nodiscard]] static std::uint64_t head_tag(std::uint64_t head) noexcept {
+        return head >> 48;
+    }
+
+    [[nodiscard]] static std::uint64_t make_head(FreeNode* node, std::uint64_t tag) noexcept {
+        return (tag << 48) | (reinterpret_cast<std::uint64_t>(node) & PTR_MASK);
+    }
+
+    std::atomic<std::uint64_t> m_head{0};
+    std::atomic<std::size_t> m_free_count{0};
+};
+
+// Global pool shared by every chunk (same pattern as global_thread_pool)
+[[nodiscard]] inline ChunkBufferPool& chunk_buffer_pool() {
+    static ChunkBufferPool pool;
+    return pool;
+}
+
 // =============================================================================
 // MEMORY UTILITIES
 // =============================================================================
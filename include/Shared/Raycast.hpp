@@ -5,6 +5,7 @@
 #pragma once
 
 #include "Shared/Types.hpp"
+#include "Shared/Chunk.hpp"
 #include <cmath>
 #include <cstdint>
 
@@ -176,6 +177,77 @@ public:
             std::forward<GetVoxelFn>(get_voxel)
         );
     }
+
+    // =============================================================================
+    // CHUNK-CACHING TRAVERSAL
+    // Consecutive steps are almost always inside the same 64^3 chunk, so
+    // resolving a Chunk* per voxel (a chunk-map lookup under the world
+    // shared lock) wastes nearly all of the lookup work. This variant
+    // asks the GetChunkFn callback only when the ray crosses a chunk
+    // boundary and reads voxels through Chunk::get until it exits.
+    // An unloaded chunk (nullptr) is skipped as air.
+    // =============================================================================
+
+    // Callback type: (ChunkCoord cx, cy, cz) -> const Chunk*
+    template<typename GetChunkFn>
+    static RaycastHit cast_cached(
+        double origin_x, double origin_y, double origin_z,
+        float dir_x, float dir_y, float dir_z,
+        float max_distance,
+        GetChunkFn&& get_chunk
+    ) {
+        // Chunk resolved for the voxel most recently sampled
+        const Chunk* chunk = nullptr;
+        ChunkCoord chunk_x = 0, chunk_y = 0, chunk_z = 0;
+        bool chunk_valid = false;
+
+        return cast(
+            origin_x, origin_y, origin_z,
+            dir_x, dir_y, dir_z,
+            max_distance,
+            [&](std::int64_t x, std::int64_t y, std::int64_t z) -> Voxel {
+                const ChunkCoord cx = coord::world_to_chunk(x);
+                const ChunkCoord cy = coord::world_to_chunk(y);
+                const ChunkCoord cz = coord::world_to_chunk(z);
+
+                if (!chunk_valid || cx != chunk_x || cy != chunk_y || cz != chunk_z) {
+                    chunk = get_chunk(cx, cy, cz);
+                    chunk_x = cx;
+                    chunk_y = cy;
+                    chunk_z = cz;
+                    chunk_valid = true;
+                }
+
+                if (!chunk) {
+                    return Voxel{};  // Unloaded chunk reads as air
+                }
+                return chunk->get(
+                    coord::world_to_local(x),
+                    coord::world_to_local(y),
+                    coord::world_to_local(z));
+            }
+        );
+    }
+
+    // Convenience overload for Vec3 types
+    template<typename Vec3Origin, typename Vec3Dir, typename GetChunkFn>
+    static RaycastHit cast_cached(
+        const Vec3Origin& origin,
+        const Vec3Dir& direction,
+        float max_distance,
+        GetChunkFn&& get_chunk
+    ) {
+        return cast_cached(
+            static_cast<double>(origin.x),
+            static_cast<double>(origin.y),
+            static_cast<double>(origin.z),
+            static_cast<float>(direction.x),
+            static_cast<float>(direction.y),
+            static_cast<float>(direction.z),
+            max_distance,
+            std::forward<GetChunkFn>(get_chunk)
+        );
+    }
 };
 
 } // namespace voxel
@@ -1,11 +1,11 @@
 // =============================================================================
 // VOXEL ENGINE - THREAD POOL
-// Lock-free work-stealing thread pool for background tasks
+// Work-stealing thread pool with per-worker deques and a priority lane
 // =============================================================================
 #pragma once
 
 #include <vector>
-#include <queue>
+#include <deque>
 #include <thread>
 #include <mutex>
 #include <condition_variable>
@@ -15,98 +15,101 @@
 
 namespace voxel {
 
+// =============================================================================
+// TASK PRIORITY
+// HIGH tasks (e.g. remesh of camera-adjacent chunks) are drained before
+// any NORMAL work (far-away generation, write-back)
+// =============================================================================
+enum class TaskPriority : std::uint8_t {
+    NORMAL = 0,
+    HIGH = 1
+};
+
 // =============================================================================
 // THREAD POOL
-// Generic thread pool for background work
+// Tasks are distributed round-robin across per-worker deques, each with
+// its own lock. Owners pop newest-first (cache-warm), idle workers steal
+// oldest-first from siblings, so one hot submitter no longer serializes
+// twelve workers on a single queue mutex. A shared HIGH lane is checked
+// before any deque.
 // =============================================================================
 class ThreadPool {
 public:
-    explicit ThreadPool(std::size_t num_threads = 0) 
-        : m_stop(false) 
+    explicit ThreadPool(std::size_t num_threads = 0)
+        : m_stop(false)
     {
         if (num_threads == 0) {
             num_threads = std::max(1u, std::thread::hardware_concurrency() - 1);
         }
-        
+
+        m_queues = std::make_unique<WorkerQueue[]>(num_threads);
+        m_queue_count = num_threads;
+
         m_workers.reserve(num_threads);
         for (std::size_t i = 0; i < num_threads; ++i) {
-            m_workers.emplace_back([this] { worker_loop(); });
+            m_workers.emplace_back([this, i] { worker_loop(i); });
         }
     }
-    
+
     ~ThreadPool() {
         shutdown();
     }
-    
+
     // Non-copyable, non-movable
     ThreadPool(const ThreadPool&) = delete;
     ThreadPool& operator=(const ThreadPool&) = delete;
     ThreadPool(ThreadPool&&) = delete;
     ThreadPool& operator=(ThreadPool&&) = delete;
-    
+
     // Submit a task and get a future for the result
     template<typename F, typename... Args>
     auto submit(F&& f, Args&&... args) -> std::future<decltype(f(args...))> {
         using ReturnType = decltype(f(args...));
-        
+
         auto task = std::make_shared<std::packaged_task<ReturnType()>>(
             std::bind(std::forward<F>(f), std::forward<Args>(args)...)
         );
-        
+
         std::future<ReturnType> result = task->get_future();
-        
-        {
-            std::lock_guard<std::mutex> lock(m_mutex);
-            if (m_stop) {
-                // Pool is stopping, don't accept new tasks
-                return result;
-            }
-            m_tasks.emplace([task]() { (*task)(); });
-        }
-        
-        m_condition.notify_one();
+        push_task([task]() { (*task)(); }, TaskPriority::NORMAL);
         return result;
     }
-    
+
     // Submit a fire-and-forget task
-    void submit_detached(std::function<void()> task) {
-        {
-            std::lock_guard<std::mutex> lock(m_mutex);
-            if (m_stop) return;
-            m_tasks.emplace(std::move(task));
-        }
-        m_condition.notify_one();
+    void submit_detached(std::function<void()> task,
+                         TaskPriority priority = TaskPriority::NORMAL) {
+        push_task(std::move(task), priority);
     }
-    
+
     // Get number of worker threads
     [[nodiscard]] std::size_t size() const noexcept {
         return m_workers.size();
     }
-    
+
     // Get approximate number of pending tasks
     [[nodiscard]] std::size_t pending_tasks() const {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        return m_tasks.size();
+        return m_task_count.load(std::memory_order_relaxed);
     }
-    
+
     // Wait for all tasks to complete
     void wait_idle() {
-        std::unique_lock<std::mutex> lock(m_mutex);
+        std::unique_lock<std::mutex> lock(m_sleep_mutex);
         m_idle_condition.wait(lock, [this] {
-            return m_tasks.empty() && m_active_tasks == 0;
+            return m_task_count.load(std::memory_order_acquire) == 0 &&
+                   m_active_tasks.load(std::memory_order_acquire) == 0;
         });
     }
-    
+
     // Shutdown the pool
     void shutdown() {
         {
-            std::lock_guard<std::mutex> lock(m_mutex);
+            std::lock_guard<std::mutex> lock(m_sleep_mutex);
             if (m_stop) return;
             m_stop = true;
         }
-        
+
         m_condition.notify_all();
-        
+
         for (auto& worker : m_workers) {
             if (worker.joinable()) {
                 worker.join();
@@ -114,49 +117,131 @@ public:
         }
         m_workers.clear();
     }
-    
+
 private:
-    void worker_loop() {
+    // One deque per worker, cache-line aligned so queue locks never
+    // false-share. The mutex only covers this worker plus occasional
+    // thieves - never the whole pool.
+    struct alignas(64) WorkerQueue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    void push_task(std::function<void()> task, TaskPriority priority) {
+        {
+            std::lock_guard<std::mutex> lock(m_sleep_mutex);
+            if (m_stop) return;
+        }
+
+        if (priority == TaskPriority::HIGH) {
+            std::lock_guard<std::mutex> lock(m_priority_mutex);
+            m_priority_tasks.emplace_back(std::move(task));
+        } else {
+            // Round-robin across worker deques
+            const std::size_t index =
+                m_next_queue.fetch_add(1, std::memory_order_relaxed) % m_queue_count;
+            WorkerQueue& queue = m_queues[index];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.tasks.emplace_back(std::move(task));
+        }
+
+        m_task_count.fetch_add(1, std::memory_order_release);
+        m_condition.notify_one();
+    }
+
+    // Pop order: HIGH lane, then own deque (newest first), then steal
+    // from siblings (oldest first)
+    [[nodiscard]] bool try_pop(std::size_t worker_index, std::function<void()>& out_task) {
+        {
+            std::lock_guard<std::mutex> lock(m_priority_mutex);
+            if (!m_priority_tasks.empty()) {
+                out_task = std::move(m_priority_tasks.front());
+                m_priority_tasks.pop_front();
+                return true;
+            }
+        }
+
+        {
+            WorkerQueue& own = m_queues[worker_index];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            if (!own.tasks.empty()) {
+                out_task = std::move(own.tasks.back());
+                own.tasks.pop_back();
+                return true;
+            }
+        }
+
+        for (std::size_t offset = 1; offset < m_queue_count; ++offset) {
+            WorkerQueue& victim = m_queues[(worker_index + offset) % m_queue_count];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (!victim.tasks.empty()) {
+                out_task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void worker_loop(std::size_t worker_index) {
         while (true) {
             std::function<void()> task;
-            
-            {
-                std::unique_lock<std::mutex> lock(m_mutex);
+
+            if (!try_pop(worker_index, task)) {
+                std::unique_lock<std::mutex> lock(m_sleep_mutex);
                 m_condition.wait(lock, [this] {
-                    return m_stop || !m_tasks.empty();
+                    return m_stop || m_task_count.load(std::memory_order_acquire) > 0;
                 });
-                
-                if (m_stop && m_tasks.empty()) {
+
+                if (m_stop && m_task_count.load(std::memory_order_acquire) == 0) {
                     return;
                 }
-                
-                task = std::move(m_tasks.front());
-                m_tasks.pop();
-                ++m_active_tasks;
+                continue;
             }
-            
-            // Execute task outside lock
+
+            m_active_tasks.fetch_add(1, std::memory_order_acq_rel);
+            m_task_count.fetch_sub(1, std::memory_order_acq_rel);
+
+            // Execute task outside all locks
             task();
-            
-            {
-                std::lock_guard<std::mutex> lock(m_mutex);
-                --m_active_tasks;
-                if (m_tasks.empty() && m_active_tasks == 0) {
-                    m_idle_condition.notify_all();
-                }
+
+            if (m_active_tasks.fetch_sub(1, std::memory_order_acq_rel) == 1 &&
+                m_task_count.load(std::memory_order_acquire) == 0) {
+                std::lock_guard<std::mutex> lock(m_sleep_mutex);
+                m_idle_condition.notify_all();
             }
         }
     }
-    
+
     std::vector<std::thread> m_workers;
-    std::queue<std::function<void()>> m_tasks;
-    
-    mutable std::mutex m_mutex;
+
+    // Per-worker task deques
+    std::unique_ptr<WorkerQueue[]> m_queues;
+    std::size_t m_queue_count = 0;
+    std::atomic<std::size_t> m_next_queue{0};
+
+    // HIGH lane: small, shared, drained before any deque
+    mutable std::mutex m_priority_mutex;
+    std::deque<std::function<void()>> m_priority_tasks;
+
+    // Sleep/wake coordination (queues have their own locks)
+    mutable std::mutex m_sleep_mutex;
     std::condition_variable m_condition;
     std::condition_variable m_idle_condition;
-    
+
+    std::atomic<std::size_t> m_task_count{0};
     std::atomic<std::size_t> m_active_tasks{0};
     bool m_stop;
 };
 
+// =============================================================================
+// SHARED POOL
+// Process-wide pool for background work (chunk generation, meshing, I/O)
+// =============================================================================
+[[nodiscard]] inline ThreadPool& global_thread_pool() {
+    static ThreadPool pool;
+    return pool;
+}
+
 } // namespace voxel
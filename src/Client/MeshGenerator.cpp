@@ -47,20 +47,43 @@ void MeshGenerator::generate(
         return;
     }
 
-    // Generate mesh for each face direction
+    // One pass over the volume builds opacity columns for all 6 directions
+    build_occupancy(chunk);
+
+    // Quads land in (face, slice) bucket order; record per-bucket
+    // counts so a later incremental remesh can splice rebuilt slices
+    out_mesh.slice_quads.assign(FACE_COUNT * SIZE, 0);
+
+    // Opaque pass for each face direction
     for (std::uint8_t face = 0; face < FACE_COUNT; ++face) {
         const Face f = static_cast<Face>(face);
 
         // Build face visibility data for this direction
-        build_face_masks(chunk, f, neighbor_accessor);
+        build_face_masks<MeshPass::OPAQUE>(chunk, f, neighbor_accessor);
 
         // Perform greedy meshing on each slice
         for (std::uint32_t slice = 0; slice < SIZE; ++slice) {
-            greedy_mesh_slice(slice, f, out_mesh);
+            const std::uint32_t quads_before = out_mesh.quad_count;
+            greedy_mesh_slice<MeshPass::OPAQUE>(slice, f, out_mesh);
+            out_mesh.slice_quads[face * SIZE + slice] =
+                static_cast<std::uint16_t>(out_mesh.quad_count - quads_before);
         }
     }
 
-    out_mesh.is_empty = (out_mesh.quad_count == 0);
+    // Translucent pass (fluids, glass) feeds the separate sub-mesh the
+    // renderer draws blended after all opaque geometry; chunks without
+    // special voxels skip it entirely
+    if (!m_special_voxels.empty()) {
+        for (std::uint8_t face = 0; face < FACE_COUNT; ++face) {
+            const Face f = static_cast<Face>(face);
+            build_face_masks<MeshPass::TRANSLUCENT>(chunk, f, neighbor_accessor);
+            for (std::uint32_t slice = 0; slice < SIZE; ++slice) {
+                greedy_mesh_slice<MeshPass::TRANSLUCENT>(slice, f, out_mesh);
+            }
+        }
+    }
+
+    out_mesh.is_empty = (out_mesh.quad_count == 0 && out_mesh.translucent_quad_count == 0);
     out_mesh.needs_update = true;
 }
 
@@ -69,251 +92,715 @@ void MeshGenerator::generate_simple(const Chunk& chunk, ChunkMesh& out_mesh) {
 }
 
 // =============================================================================
-// FACE MASK BUILDING
+// INCREMENTAL GENERATION
+// A block edit dirties one 16^3 region; only the greedy slices that
+// region touches (widened one slice each way, since an edit changes the
+// face visibility of its neighbors) are re-meshed. The mesh's quads sit
+// in (face, slice) bucket order, so splicing is one pass that keeps
+// surviving buckets and substitutes the rebuilt ones.
 // =============================================================================
 
-void MeshGenerator::build_face_masks(
+void MeshGenerator::generate_incremental(
     const Chunk& chunk,
-    Face face,
+    ChunkMesh& mesh,
+    std::uint64_t dirty_regions,
     const NeighborAccessor& neighbor_accessor
 ) {
-    // Clear working buffers
-    for (auto& slice : m_face_slices) {
-        std::memset(slice.data(), 0, sizeof(FaceSlice));
+    // Nothing to splice into: first mesh of this chunk, an LOD mesh, or
+    // a bulk write flooded the mask - do the full rebuild
+    if (mesh.slice_quads.size() != static_cast<std::size_t>(FACE_COUNT) * SIZE ||
+        mesh.lod != 0 ||
+        dirty_regions == ~std::uint64_t{0} ||
+        !chunk.is_loaded() || chunk.is_empty()) {
+        generate(chunk, mesh, neighbor_accessor);
+        return;
     }
-    for (auto& mask : m_visited_masks) {
-        mask.fill(0);
+    if (dirty_regions == 0) {
+        return;
     }
 
-    // Direction vectors for each face
-    static constexpr std::int32_t dir_x[] = {-1, 1, 0, 0, 0, 0};
-    static constexpr std::int32_t dir_y[] = {0, 0, -1, 1, 0, 0};
-    static constexpr std::int32_t dir_z[] = {0, 0, 0, 0, -1, 1};
+    constexpr std::uint32_t REGION = ChunkOccupancySummary::REGION_SIZE;
 
-    const std::int32_t dx = dir_x[face];
-    const std::int32_t dy = dir_y[face];
-    const std::int32_t dz = dir_z[face];
+    // Slice sets to rebuild per axis: each dirty region covers 16
+    // slices, widened one slice on both sides
+    const auto widen = [](std::uint64_t mask) noexcept {
+        return mask | (mask << 1) | (mask >> 1);
+    };
+    std::array<std::uint64_t, 3> dirty_slices{};  // [axis: x, y, z]
+    std::uint64_t regions = dirty_regions;
+    while (regions != 0) {
+        const auto region = static_cast<std::uint32_t>(std::countr_zero(regions));
+        regions &= regions - 1;
+        const std::uint32_t ry = region & 3u;
+        const std::uint32_t rz = (region >> 2) & 3u;
+        const std::uint32_t rx = region >> 4;
+        constexpr std::uint64_t SPAN = (std::uint64_t{1} << REGION) - 1;
+        dirty_slices[0] |= widen(SPAN << (rx * REGION));
+        dirty_slices[1] |= widen(SPAN << (ry * REGION));
+        dirty_slices[2] |= widen(SPAN << (rz * REGION));
+    }
 
-    // Iterate through all voxels
-    for (std::uint32_t x = 0; x < SIZE; ++x) {
-        for (std::uint32_t y = 0; y < SIZE; ++y) {
-            for (std::uint32_t z = 0; z < SIZE; ++z) {
-                // Get current voxel
-                const Voxel voxel = chunk.get(
-                    static_cast<LocalCoord>(x),
-                    static_cast<LocalCoord>(y),
-                    static_cast<LocalCoord>(z)
-                );
+    m_stats_faces = 0;
+    m_stats_culled = 0;
 
-                // Skip air blocks
-                if (voxel.is_air()) {
-                    ++m_stats_culled;
-                    continue;
-                }
+    // One occupancy pass, shared by all rebuilt directions
+    build_occupancy(chunk);
 
-                // Check neighbor in face direction
-                const std::int32_t nx = static_cast<std::int32_t>(x) + dx;
-                const std::int32_t ny = static_cast<std::int32_t>(y) + dy;
-                const std::int32_t nz = static_cast<std::int32_t>(z) + dz;
-
-                bool should_cull = false;
-                
-                // Get current block properties
-                const auto& current_props = BlockRegistry::instance().get(voxel.type_id());
-
-                // Check if neighbor is within chunk
-                if (nx >= 0 && nx < static_cast<std::int32_t>(SIZE) &&
-                    ny >= 0 && ny < static_cast<std::int32_t>(SIZE) &&
-                    nz >= 0 && nz < static_cast<std::int32_t>(SIZE)) {
-                    // Neighbor is in same chunk
-                    const Voxel neighbor = chunk.get(
-                        static_cast<LocalCoord>(nx),
-                        static_cast<LocalCoord>(ny),
-                        static_cast<LocalCoord>(nz)
-                    );
-                    
-                    // Get neighbor properties from BlockRegistry
-                    const auto& neighbor_props = BlockRegistry::instance().get(neighbor.type_id());
-                    
-                    // WATER/FLUID CULLING RULES:
-                    // Show face if:
-                    //   - Neighbor is AIR
-                    //   - Neighbor is a different block type
-                    //   - Neighbor is same fluid but has DIFFERENT liquid_level
-                    // Cull face if:
-                    //   - Neighbor is opaque AND current is opaque
-                    //   - Neighbor is same fluid with SAME liquid_level (smooth water body)
-                    if (!neighbor.is_air()) {
-                        if (!neighbor_props.is_transparent && !current_props.is_transparent) {
-                            // Both opaque - cull
-                            should_cull = true;
-                        } else if (current_props.is_fluid && neighbor.type_id() == voxel.type_id()) {
-                            // Same fluid type - cull if levels are EQUAL (smooth water body)
-                            // Show face only if levels differ (water step visible)
-                            std::uint8_t current_level = voxel.fluid_level();
-                            std::uint8_t neighbor_level = neighbor.fluid_level();
-                            if (current_level == 0) current_level = Voxel::FLUID_LEVEL_FULL;
-                            if (neighbor_level == 0) neighbor_level = Voxel::FLUID_LEVEL_FULL;
-                            // Cull if same level = internal wall that shouldn't be visible
-                            should_cull = (current_level == neighbor_level);
-                        } else if (neighbor_props.is_transparent && current_props.is_transparent &&
-                                   neighbor.type_id() == voxel.type_id()) {
-                            // Same non-fluid transparent type - cull internal faces
-                            should_cull = !current_props.render_all_faces;
-                        }
-                        // Different types or opaque behind transparent - don't cull
-                    }
-                } else if (m_config.enable_face_culling && neighbor_accessor) {
-                    // Neighbor is in adjacent chunk
-                    const ChunkPosition& pos = chunk.position();
-                    ChunkCoord world_x = coord::chunk_to_world(pos.x) + nx;
-                    ChunkCoord world_y = coord::chunk_to_world(pos.y) + ny;
-                    ChunkCoord world_z = coord::chunk_to_world(pos.z) + nz;
-
-                    const Voxel neighbor = neighbor_accessor(world_x, world_y, world_z);
-                    const auto& neighbor_props = BlockRegistry::instance().get(neighbor.type_id());
-                    
-                    if (!neighbor.is_air()) {
-                        if (!neighbor_props.is_transparent && !current_props.is_transparent) {
-                            should_cull = true;
-                        } else if (current_props.is_fluid && neighbor.type_id() == voxel.type_id()) {
-                            // Same fluid type - cull if levels are EQUAL (smooth water body)
-                            std::uint8_t current_level = voxel.fluid_level();
-                            std::uint8_t neighbor_level = neighbor.fluid_level();
-                            if (current_level == 0) current_level = Voxel::FLUID_LEVEL_FULL;
-                            if (neighbor_level == 0) neighbor_level = Voxel::FLUID_LEVEL_FULL;
-                            should_cull = (current_level == neighbor_level);
-                        } else if (neighbor_props.is_transparent && current_props.is_transparent &&
-                                   neighbor.type_id() == voxel.type_id()) {
-                            should_cull = !current_props.render_all_faces;
+    // Re-mesh the dirty slices into the scratch mesh (bucket counts
+    // recorded the same way as a full generate)
+    m_incr_mesh.clear();
+    m_incr_mesh.slice_quads.assign(static_cast<std::size_t>(FACE_COUNT) * SIZE, 0);
+    for (std::uint8_t face = 0; face < FACE_COUNT; ++face) {
+        const Face f = static_cast<Face>(face);
+        const std::uint64_t slices = dirty_slices[face >> 1];
+        if (slices == 0) {
+            continue;
+        }
+
+        build_face_masks<MeshPass::OPAQUE>(chunk, f, neighbor_accessor);
+
+        std::uint64_t remaining = slices;
+        while (remaining != 0) {
+            const auto slice = static_cast<std::uint32_t>(std::countr_zero(remaining));
+            remaining &= remaining - 1;
+            const std::uint32_t quads_before = m_incr_mesh.quad_count;
+            greedy_mesh_slice<MeshPass::OPAQUE>(slice, f, m_incr_mesh);
+            m_incr_mesh.slice_quads[face * SIZE + slice] =
+                static_cast<std::uint16_t>(m_incr_mesh.quad_count - quads_before);
+        }
+    }
+
+    // Splice: walk opaque buckets in order, keeping surviving quads and
+    // taking rebuilt ones from the scratch mesh. add_quad re-derives
+    // indices, so only vertices need to be carried over.
+    m_old_vertices = std::move(mesh.vertices);
+    m_old_counts = std::move(mesh.slice_quads);
+    mesh.clear();
+    mesh.slice_quads.assign(static_cast<std::size_t>(FACE_COUNT) * SIZE, 0);
+    mesh.reserve(m_old_vertices.size() / 4 + m_incr_mesh.quad_count);
+
+    std::size_t old_quad = 0;
+    std::size_t new_quad = 0;
+    for (std::uint32_t bucket = 0; bucket < FACE_COUNT * SIZE; ++bucket) {
+        const std::uint32_t slice = bucket % SIZE;
+        const bool rebuilt = (dirty_slices[(bucket / SIZE) >> 1] >> slice) & 1u;
+        if (rebuilt) {
+            const std::uint16_t count = m_incr_mesh.slice_quads[bucket];
+            for (std::uint16_t q = 0; q < count; ++q, ++new_quad) {
+                const PackedVertex* v = &m_incr_mesh.vertices[new_quad * 4];
+                mesh.add_quad(v[0], v[1], v[2], v[3]);
+            }
+            old_quad += m_old_counts[bucket];  // Stale quads dropped
+            mesh.slice_quads[bucket] = count;
+        } else {
+            const std::uint16_t count = m_old_counts[bucket];
+            for (std::uint16_t q = 0; q < count; ++q, ++old_quad) {
+                const PackedVertex* v = &m_old_vertices[old_quad * 4];
+                mesh.add_quad(v[0], v[1], v[2], v[3]);
+            }
+            mesh.slice_quads[bucket] = count;
+        }
+    }
+
+    // The translucent stream is a small fraction of the chunk (mesh.clear
+    // dropped it above), so rebuild it whole instead of splicing
+    if (!m_special_voxels.empty()) {
+        for (std::uint8_t face = 0; face < FACE_COUNT; ++face) {
+            const Face f = static_cast<Face>(face);
+            build_face_masks<MeshPass::TRANSLUCENT>(chunk, f, neighbor_accessor);
+            for (std::uint32_t slice = 0; slice < SIZE; ++slice) {
+                greedy_mesh_slice<MeshPass::TRANSLUCENT>(slice, f, mesh);
+            }
+        }
+    }
+
+    mesh.is_empty = (mesh.quad_count == 0 && mesh.translucent_quad_count == 0);
+    mesh.needs_update = true;
+}
+
+// =============================================================================
+// LOD GENERATION
+// Downsampled meshing for distant chunks: the chunk collapses into a
+// (SIZE >> lod)^3 cell grid and only faces between solid and empty cells
+// are emitted. Chunk-boundary faces are always emitted because the
+// neighbor may be meshed at a different level (or not at all).
+// =============================================================================
+
+void MeshGenerator::generate_lod(const Chunk& chunk, ChunkMesh& out_mesh, std::uint8_t lod) {
+    if (lod == 0) {
+        generate_simple(chunk, out_mesh);
+        return;
+    }
+
+    if (!chunk.is_loaded() || chunk.is_empty()) {
+        out_mesh.clear();
+        out_mesh.position = chunk.position();
+        out_mesh.lod = std::min(lod, MAX_LOD);
+        m_stats_faces = 0;
+        m_stats_culled = 0;
+        return;
+    }
+
+    generate_lod_from_data(chunk.snapshot().get(), out_mesh, lod);
+    out_mesh.position = chunk.position();
+}
+
+void MeshGenerator::generate_lod_from_data(const Voxel* voxels, ChunkMesh& out_mesh, std::uint8_t lod) {
+    out_mesh.clear();
+    out_mesh.lod = std::clamp<std::uint8_t>(lod, 1, MAX_LOD);
+
+    m_stats_faces = 0;
+    m_stats_culled = 0;
+
+    const std::uint32_t step = 1u << out_mesh.lod;
+    const std::uint32_t cells = SIZE >> out_mesh.lod;
+
+    m_lod_cells.assign(static_cast<std::size_t>(cells) * cells * cells, 0);
+
+    const auto& registry = BlockRegistry::instance();
+
+    // Conservative downsample: any occupied sub-voxel makes the cell
+    // solid so distant silhouettes stay hole-free. The cell takes the
+    // first opaque type found, falling back to the first transparent
+    // one (an acceptable approximation at these distances).
+    for (std::uint32_t cx = 0; cx < cells; ++cx) {
+        for (std::uint32_t cz = 0; cz < cells; ++cz) {
+            for (std::uint32_t cy = 0; cy < cells; ++cy) {
+                std::uint16_t chosen = 0;
+                std::uint16_t fallback = 0;
+                for (std::uint32_t x = cx * step; x < (cx + 1) * step && chosen == 0; ++x) {
+                    for (std::uint32_t z = cz * step; z < (cz + 1) * step && chosen == 0; ++z) {
+                        for (std::uint32_t y = cy * step; y < (cy + 1) * step; ++y) {
+                            const Voxel v = voxels[coord::to_index(
+                                static_cast<LocalCoord>(x),
+                                static_cast<LocalCoord>(y),
+                                static_cast<LocalCoord>(z)
+                            )];
+                            if (v.is_air()) {
+                                continue;
+                            }
+                            if (!(registry.flags(v.type_id()) & BlockFlags::TRANSPARENT)) {
+                                chosen = v.type_id();
+                                break;
+                            }
+                            if (fallback == 0) {
+                                fallback = v.type_id();
+                            }
                         }
                     }
                 }
+                if (chosen == 0) {
+                    chosen = fallback;
+                }
+                m_lod_cells[(cx * cells + cz) * cells + cy] = chosen;
+            }
+        }
+    }
+
+    const auto cell_at = [&](std::int32_t cx, std::int32_t cy, std::int32_t cz) -> std::uint16_t {
+        const auto n = static_cast<std::int32_t>(cells);
+        if (cx < 0 || cy < 0 || cz < 0 || cx >= n || cy >= n || cz >= n) {
+            return 0;  // Out of chunk: treat as empty so boundary faces emit
+        }
+        const auto ux = static_cast<std::uint32_t>(cx);
+        const auto uy = static_cast<std::uint32_t>(cy);
+        const auto uz = static_cast<std::uint32_t>(cz);
+        return m_lod_cells[(ux * cells + uz) * cells + uy];
+    };
+
+    static constexpr std::int32_t DX[FACE_COUNT] = {-1, 1, 0, 0, 0, 0};
+    static constexpr std::int32_t DY[FACE_COUNT] = {0, 0, -1, 1, 0, 0};
+    static constexpr std::int32_t DZ[FACE_COUNT] = {0, 0, 0, 0, -1, 1};
 
-                // Face culling
-                if (m_config.enable_face_culling && should_cull) {
-                    ++m_stats_culled;
+    for (std::uint32_t cx = 0; cx < cells; ++cx) {
+        for (std::uint32_t cz = 0; cz < cells; ++cz) {
+            for (std::uint32_t cy = 0; cy < cells; ++cy) {
+                const std::uint16_t type = m_lod_cells[(cx * cells + cz) * cells + cy];
+                if (type == 0) {
                     continue;
                 }
 
-                // Determine slice coordinate based on face direction
-                std::uint32_t slice_coord, u_coord, v_coord;
-                switch (face) {
-                    case FACE_NEG_X:
-                    case FACE_POS_X:
-                        slice_coord = x;
-                        u_coord = z;
-                        v_coord = y;
-                        break;
-                    case FACE_NEG_Y:
-                    case FACE_POS_Y:
-                        slice_coord = y;
-                        u_coord = x;
-                        v_coord = z;
-                        break;
-                    case FACE_NEG_Z:
-                    case FACE_POS_Z:
-                    default:
-                        slice_coord = z;
-                        u_coord = x;
-                        v_coord = y;
-                        break;
+                // LOD cells span 2^lod voxels; sampling per-voxel light
+                // is meaningless at that scale, so distant chunks bake
+                // fully lit
+                const FaceData data{type, 255, 0, 0};
+
+                for (std::uint8_t face = 0; face < FACE_COUNT; ++face) {
+                    const auto ix = static_cast<std::int32_t>(cx) + DX[face];
+                    const auto iy = static_cast<std::int32_t>(cy) + DY[face];
+                    const auto iz = static_cast<std::int32_t>(cz) + DZ[face];
+                    if (cell_at(ix, iy, iz) != 0) {
+                        ++m_stats_culled;
+                        continue;
+                    }
+
+                    add_lod_face_quad(
+                        out_mesh,
+                        cx * step, cy * step, cz * step,
+                        step,
+                        static_cast<Face>(face),
+                        data
+                    );
+                    ++m_stats_faces;
+                }
+            }
+        }
+    }
+
+    out_mesh.is_empty = (out_mesh.quad_count == 0);
+    out_mesh.needs_update = true;
+}
+
+// =============================================================================
+// OCCUPANCY BUILD
+// =============================================================================
+
+void MeshGenerator::build_occupancy(const Chunk& chunk) {
+    m_occ_x.fill(0);
+    m_occ_y.fill(0);
+    m_occ_z.fill(0);
+    m_special_voxels.clear();
+
+    const auto& registry = BlockRegistry::instance();
+
+    // Region counts let entire 16^3 all-air cells be skipped without
+    // touching voxel storage (common in terrain chunks that are mostly
+    // sky). Fully-solid regions still scan: non-air includes transparent
+    // voxels, which need the special-voxel path.
+    const ChunkOccupancySummary& occ = chunk.occupancy();
+    constexpr std::uint32_t REGION = ChunkOccupancySummary::REGION_SIZE;
+
+    // Y varies fastest in chunk storage, so the inner loop reads
+    // contiguous memory; opaque voxels scatter one bit per axis
+    for (std::uint32_t x = 0; x < SIZE; ++x) {
+        for (std::uint32_t z = 0; z < SIZE; ++z) {
+            for (std::uint32_t ry = 0; ry < ChunkOccupancySummary::REGIONS_PER_AXIS; ++ry) {
+                if (occ.region_empty(x / REGION, ry, z / REGION)) {
+                    continue;
                 }
+                for (std::uint32_t y = ry * REGION; y < (ry + 1) * REGION; ++y) {
+                    const Voxel voxel = chunk.get(
+                        static_cast<LocalCoord>(x),
+                        static_cast<LocalCoord>(y),
+                        static_cast<LocalCoord>(z)
+                    );
+                    if (voxel.is_air()) {
+                        continue;
+                    }
 
-                // Store face data
-                const std::uint32_t slice_index = v_coord * SIZE + u_coord;
-                FaceData& face_data = m_face_slices[slice_coord][slice_index];
-                face_data.voxel_type = voxel.type_id();
-                // Force full brightness until proper lighting is implemented
-                face_data.light = 255;
-                face_data.ao = 0; // TODO: Calculate AO
-                
-                // Store fluid level for water/lava height lowering
-                // Level meanings:
-                //   0 = source block (stored as 8 for shader: full height)
-                //   1-7 = flowing water (1=near source=high, 7=far=low)
-                if (current_props.is_fluid) {
-                    std::uint8_t raw_level = voxel.fluid_level();
-                    if (raw_level == 0) {
-                        // Source block - full height
-                        face_data.fluid_level = Voxel::FLUID_LEVEL_FULL;  // 8
+                    if (registry.flags(voxel.type_id()) & BlockFlags::TRANSPARENT) {
+                        // Fluids and glass cull by type and fluid level -
+                        // they take the scalar rule path per direction
+                        m_special_voxels.push_back(coord::to_index(
+                            static_cast<LocalCoord>(x),
+                            static_cast<LocalCoord>(y),
+                            static_cast<LocalCoord>(z)
+                        ));
                     } else {
-                        // Flowing water - keep raw level (1-7)
-                        // Shader will interpret: 1=7/8 height, 7=1/8 height
-                        face_data.fluid_level = raw_level;
+                        m_occ_y[x * SIZE + z] |= 1ULL << y;
+                        m_occ_x[y * SIZE + z] |= 1ULL << x;
+                        m_occ_z[x * SIZE + y] |= 1ULL << z;
                     }
+                }
+            }
+        }
+    }
+}
+
+// =============================================================================
+// FACE MASK BUILDING
+// Opaque-vs-opaque culling is pure bit arithmetic: a column of voxels
+// along the face axis fits exactly in a uint64_t, so the visible set is
+// occ & ~(occ shifted toward the face), and set bits are walked with
+// count-trailing-zeros. Only chunk-boundary columns touch the neighbor
+// accessor, and only when their boundary voxel is actually occupied.
+// The translucent specialization is the complementary scalar path over
+// m_special_voxels; the opaque one never looks at them.
+// =============================================================================
+
+template <MeshGenerator::MeshPass Pass>
+void MeshGenerator::build_face_masks(
+    const Chunk& chunk,
+    Face face,
+    const NeighborAccessor& neighbor_accessor
+) {
+    // Slice cells are only read where the occupancy bit is set, so the
+    // FaceData arrays themselves never need clearing
+    for (auto& mask : m_slice_occupancy) {
+        mask.fill(0);
+    }
+
+    if constexpr (Pass == MeshPass::TRANSLUCENT) {
+        // Transparent/fluid voxels keep the full per-type culling rules
+        for (const std::uint32_t packed : m_special_voxels) {
+            const auto x = static_cast<std::uint32_t>((packed >> CHUNK_SHIFT_X) & CHUNK_MASK);
+            const auto z = static_cast<std::uint32_t>((packed >> CHUNK_SHIFT_Z) & CHUNK_MASK);
+            const auto y = static_cast<std::uint32_t>(packed & CHUNK_MASK);
+            process_special_voxel(chunk, x, y, z, face, neighbor_accessor);
+        }
+        return;
+    }
+
+    const std::uint32_t faces_before = m_stats_faces;
+
+    const bool cull = m_config.enable_face_culling;
+    const bool negative = (face & 1u) == 0;
+    const std::uint32_t axis = face >> 1; // 0 = X, 1 = Y, 2 = Z
+
+    const auto& registry = BlockRegistry::instance();
+    const ChunkPosition& pos = chunk.position();
+    const ChunkCoord base_x = coord::chunk_to_world(pos.x);
+    const ChunkCoord base_y = coord::chunk_to_world(pos.y);
+    const ChunkCoord base_z = coord::chunk_to_world(pos.z);
+
+    // Opacity test for a voxel in the adjacent chunk
+    const auto neighbor_opaque = [&](std::uint32_t x, std::uint32_t y, std::uint32_t z,
+                                     std::int32_t dx, std::int32_t dy, std::int32_t dz) {
+        const Voxel v = neighbor_accessor(
+            base_x + static_cast<ChunkCoord>(static_cast<std::int32_t>(x) + dx),
+            base_y + static_cast<ChunkCoord>(static_cast<std::int32_t>(y) + dy),
+            base_z + static_cast<ChunkCoord>(static_cast<std::int32_t>(z) + dz)
+        );
+        return !v.is_air() && !(registry.flags(v.type_id()) & BlockFlags::TRANSPARENT);
+    };
+
+    for (std::uint32_t a = 0; a < SIZE; ++a) {
+        for (std::uint32_t b = 0; b < SIZE; ++b) {
+            // Column along the face axis; (a, b) are the other two axes
+            std::uint64_t occ;
+            switch (axis) {
+                case 0:  occ = m_occ_x[a * SIZE + b]; break; // a = y, b = z
+                case 1:  occ = m_occ_y[a * SIZE + b]; break; // a = x, b = z
+                default: occ = m_occ_z[a * SIZE + b]; break; // a = x, b = y
+            }
+            if (occ == 0) {
+                continue;
+            }
+
+            // Map an axis coordinate back to local (x, y, z)
+            const auto to_local = [&](std::uint32_t n, std::uint32_t& x, std::uint32_t& y, std::uint32_t& z) {
+                switch (axis) {
+                    case 0:  x = n; y = a; z = b; break;
+                    case 1:  x = a; y = n; z = b; break;
+                    default: x = a; y = b; z = n; break;
+                }
+            };
+
+            std::uint64_t vis = occ;
+            if (cull) {
+                if (negative) {
+                    // Neighbor toward -axis occupies bit n-1; boundary
+                    // voxel (bit 0) checks the adjacent chunk
+                    std::uint64_t behind = occ << 1;
+                    if ((occ & 1ULL) != 0 && neighbor_accessor) {
+                        std::uint32_t x, y, z;
+                        to_local(0, x, y, z);
+                        if (neighbor_opaque(x, y, z,
+                                            axis == 0 ? -1 : 0,
+                                            axis == 1 ? -1 : 0,
+                                            axis == 2 ? -1 : 0)) {
+                            behind |= 1ULL;
+                        }
+                    }
+                    vis = occ & ~behind;
                 } else {
-                    face_data.fluid_level = 0;
+                    std::uint64_t behind = occ >> 1;
+                    if ((occ >> 63) != 0 && neighbor_accessor) {
+                        std::uint32_t x, y, z;
+                        to_local(SIZE - 1, x, y, z);
+                        if (neighbor_opaque(x, y, z,
+                                            axis == 0 ? 1 : 0,
+                                            axis == 1 ? 1 : 0,
+                                            axis == 2 ? 1 : 0)) {
+                            behind |= 1ULL << 63;
+                        }
+                    }
+                    vis = occ & ~behind;
                 }
+            }
+
+            // Each surviving bit is a visible opaque face
+            while (vis != 0) {
+                const auto n = static_cast<std::uint32_t>(std::countr_zero(vis));
+                vis &= vis - 1;
+
+                std::uint32_t x, y, z;
+                to_local(n, x, y, z);
+
+                const Voxel voxel = chunk.get(
+                    static_cast<LocalCoord>(x),
+                    static_cast<LocalCoord>(y),
+                    static_cast<LocalCoord>(z)
+                );
+
+                FaceData data{};
+                data.voxel_type = voxel.type_id();
+                data.light = face_light(chunk, x, y, z, face, neighbor_accessor);
+                data.ao = 0; // TODO: Calculate AO
+                data.fluid_level = 0;
 
-                ++m_stats_faces;
+                emit_face(x, y, z, face, data);
             }
         }
     }
+
+    // Per direction, every voxel either emitted a face or was culled/air
+    m_stats_culled += SIZE_CUBE - (m_stats_faces - faces_before);
+}
+
+// =============================================================================
+// SPECIAL VOXELS (Transparent / Fluids - Scalar Rules)
+// =============================================================================
+
+void MeshGenerator::process_special_voxel(
+    const Chunk& chunk,
+    std::uint32_t x, std::uint32_t y, std::uint32_t z,
+    Face face,
+    const NeighborAccessor& neighbor_accessor
+) {
+    // Direction vectors for each face
+    static constexpr std::int32_t dir_x[] = {-1, 1, 0, 0, 0, 0};
+    static constexpr std::int32_t dir_y[] = {0, 0, -1, 1, 0, 0};
+    static constexpr std::int32_t dir_z[] = {0, 0, 0, 0, -1, 1};
+
+    const Voxel voxel = chunk.get(
+        static_cast<LocalCoord>(x),
+        static_cast<LocalCoord>(y),
+        static_cast<LocalCoord>(z)
+    );
+
+    const auto& current_props = BlockRegistry::instance().get(voxel.type_id());
+
+    const std::int32_t nx = static_cast<std::int32_t>(x) + dir_x[face];
+    const std::int32_t ny = static_cast<std::int32_t>(y) + dir_y[face];
+    const std::int32_t nz = static_cast<std::int32_t>(z) + dir_z[face];
+
+    bool should_cull = false;
+    Voxel neighbor{};
+    bool have_neighbor = false;
+
+    if (nx >= 0 && nx < static_cast<std::int32_t>(SIZE) &&
+        ny >= 0 && ny < static_cast<std::int32_t>(SIZE) &&
+        nz >= 0 && nz < static_cast<std::int32_t>(SIZE)) {
+        neighbor = chunk.get(
+            static_cast<LocalCoord>(nx),
+            static_cast<LocalCoord>(ny),
+            static_cast<LocalCoord>(nz)
+        );
+        have_neighbor = true;
+    } else if (m_config.enable_face_culling && neighbor_accessor) {
+        const ChunkPosition& pos = chunk.position();
+        neighbor = neighbor_accessor(
+            coord::chunk_to_world(pos.x) + nx,
+            coord::chunk_to_world(pos.y) + ny,
+            coord::chunk_to_world(pos.z) + nz
+        );
+        have_neighbor = true;
+    }
+
+    // WATER/FLUID CULLING RULES:
+    // Show face if:
+    //   - Neighbor is AIR
+    //   - Neighbor is a different block type
+    //   - Neighbor is same fluid but has DIFFERENT liquid_level
+    // Cull face if:
+    //   - Neighbor is opaque AND current is opaque
+    //   - Neighbor is same fluid with SAME liquid_level (smooth water body)
+    if (have_neighbor && !neighbor.is_air()) {
+        const auto& neighbor_props = BlockRegistry::instance().get(neighbor.type_id());
+
+        if (!neighbor_props.is_transparent && !current_props.is_transparent) {
+            // Both opaque - cull
+            should_cull = true;
+        } else if (current_props.is_fluid && neighbor.type_id() == voxel.type_id()) {
+            // Same fluid type - cull if levels are EQUAL (smooth water body)
+            // Show face only if levels differ (water step visible)
+            std::uint8_t current_level = voxel.fluid_level();
+            std::uint8_t neighbor_level = neighbor.fluid_level();
+            if (current_level == 0) current_level = Voxel::FLUID_LEVEL_FULL;
+            if (neighbor_level == 0) neighbor_level = Voxel::FLUID_LEVEL_FULL;
+            // Cull if same level = internal wall that shouldn't be visible
+            should_cull = (current_level == neighbor_level);
+        } else if (neighbor_props.is_transparent && current_props.is_transparent &&
+                   neighbor.type_id() == voxel.type_id()) {
+            // Same non-fluid transparent type - cull internal faces
+            should_cull = !current_props.render_all_faces;
+        }
+        // Different types or opaque behind transparent - don't cull
+    }
+
+    if (m_config.enable_face_culling && should_cull) {
+        return;
+    }
+
+    FaceData data{};
+    data.voxel_type = voxel.type_id();
+    data.light = face_light(chunk, x, y, z, face, neighbor_accessor);
+    data.ao = 0; // TODO: Calculate AO
+
+    // Store fluid level for water/lava height lowering
+    // Level meanings:
+    //   0 = source block (stored as 8 for shader: full height)
+    //   1-7 = flowing water (1=near source=high, 7=far=low)
+    if (current_props.is_fluid) {
+        const std::uint8_t raw_level = voxel.fluid_level();
+        // Source block - full height; flowing keeps raw level (1-7)
+        data.fluid_level = (raw_level == 0) ? Voxel::FLUID_LEVEL_FULL : raw_level;
+    } else {
+        data.fluid_level = 0;
+    }
+
+    emit_face(x, y, z, face, data);
+}
+
+// =============================================================================
+// FACE LIGHT SAMPLING
+// A face is lit by the cell it looks into, not by the solid block behind
+// it: the neighbor cell holds the flood-filled sun/torch nibbles, and
+// the brighter channel scales to the 8-bit value PackedVertex packs
+// (15 * 17 = 255). Light participates in FaceData equality, so greedy
+// merging splits at light gradients instead of smearing them.
+// =============================================================================
+
+std::uint8_t MeshGenerator::face_light(
+    const Chunk& chunk,
+    std::uint32_t x, std::uint32_t y, std::uint32_t z,
+    Face face,
+    const NeighborAccessor& neighbor_accessor
+) const {
+    static constexpr std::int32_t dir_x[] = {-1, 1, 0, 0, 0, 0};
+    static constexpr std::int32_t dir_y[] = {0, 0, -1, 1, 0, 0};
+    static constexpr std::int32_t dir_z[] = {0, 0, 0, 0, -1, 1};
+
+    const std::int32_t nx = static_cast<std::int32_t>(x) + dir_x[face];
+    const std::int32_t ny = static_cast<std::int32_t>(y) + dir_y[face];
+    const std::int32_t nz = static_cast<std::int32_t>(z) + dir_z[face];
+
+    Voxel cell;
+    if (nx >= 0 && nx < static_cast<std::int32_t>(SIZE) &&
+        ny >= 0 && ny < static_cast<std::int32_t>(SIZE) &&
+        nz >= 0 && nz < static_cast<std::int32_t>(SIZE)) {
+        cell = chunk.get(
+            static_cast<LocalCoord>(nx),
+            static_cast<LocalCoord>(ny),
+            static_cast<LocalCoord>(nz)
+        );
+    } else if (neighbor_accessor) {
+        const ChunkPosition& pos = chunk.position();
+        cell = neighbor_accessor(
+            coord::chunk_to_world(pos.x) + nx,
+            coord::chunk_to_world(pos.y) + ny,
+            coord::chunk_to_world(pos.z) + nz
+        );
+    } else {
+        return 255;  // No neighbor data - assume open sky
+    }
+
+    return static_cast<std::uint8_t>(cell.light_level() * 17);
+}
+
+// =============================================================================
+// FACE EMISSION
+// =============================================================================
+
+void MeshGenerator::emit_face(
+    std::uint32_t x, std::uint32_t y, std::uint32_t z,
+    Face face,
+    const FaceData& data
+) {
+    // Determine slice coordinate based on face direction
+    std::uint32_t slice_coord, u_coord, v_coord;
+    switch (face) {
+        case FACE_NEG_X:
+        case FACE_POS_X:
+            slice_coord = x;
+            u_coord = z;
+            v_coord = y;
+            break;
+        case FACE_NEG_Y:
+        case FACE_POS_Y:
+            slice_coord = y;
+            u_coord = x;
+            v_coord = z;
+            break;
+        case FACE_NEG_Z:
+        case FACE_POS_Z:
+        default:
+            slice_coord = z;
+            u_coord = x;
+            v_coord = y;
+            break;
+    }
+
+    m_face_slices[slice_coord][v_coord * SIZE + u_coord] = data;
+    m_slice_occupancy[slice_coord][v_coord] |= 1ULL << u_coord;
+    ++m_stats_faces;
 }
 
 // =============================================================================
 // GREEDY MESHING
 // =============================================================================
 
+template <MeshGenerator::MeshPass Pass>
 void MeshGenerator::greedy_mesh_slice(
     std::uint32_t slice_coord,
     Face face,
     ChunkMesh& out_mesh
 ) {
     FaceSlice& slice = m_face_slices[slice_coord];
-    SliceMask& visited = m_visited_masks[slice_coord];
-
-    // Reset visited mask
-    visited.fill(0);
+    SliceMask& occupancy = m_slice_occupancy[slice_coord];
 
     for (std::uint32_t v = 0; v < SIZE; ++v) {
-        for (std::uint32_t u = 0; u < SIZE; ++u) {
+        // Occupancy doubles as the visited mask: consumed cells are
+        // cleared, so iteration is one countr_zero per remaining quad
+        std::uint64_t avail = occupancy[v];
+        while (avail != 0) {
+            const auto u = static_cast<std::uint32_t>(std::countr_zero(avail));
             const std::uint32_t index = v * SIZE + u;
+            const FaceData start_data = slice[index];
 
-            // Skip if already visited or empty
-            if ((visited[v] & (1ULL << u)) != 0) continue;
-
-            const FaceData& start_data = slice[index];
-            if (start_data.voxel_type == 0) continue;
-
-            // Greedy expansion
             std::uint32_t width = 1;
             std::uint32_t height = 1;
 
             if (m_config.enable_greedy_meshing) {
-                // Expand width (u direction)
-                while (u + width < SIZE) {
-                    const std::uint32_t next_index = v * SIZE + (u + width);
-                    if ((visited[v] & (1ULL << (u + width))) != 0) break;
-                    if (!(slice[next_index] == start_data)) break;
+                // Expand width (u direction) within the contiguous run
+                const auto max_width = static_cast<std::uint32_t>(
+                    std::countr_one(avail >> u));
+                while (width < max_width && slice[index + width] == start_data) {
                     ++width;
                 }
+            }
+
+            const std::uint64_t run_mask = (width == SIZE)
+                ? ~0ULL
+                : (((1ULL << width) - 1ULL) << u);
 
-                // Expand height (v direction)
-                bool can_expand = true;
-                while (can_expand && v + height < SIZE) {
+            if (m_config.enable_greedy_meshing) {
+                // Expand height (v direction): the next row must have the
+                // whole run available before any per-cell comparison runs
+                while (v + height < SIZE) {
+                    if ((occupancy[v + height] & run_mask) != run_mask) {
+                        break;
+                    }
+                    bool row_matches = true;
                     for (std::uint32_t du = 0; du < width; ++du) {
-                        const std::uint32_t check_index = (v + height) * SIZE + (u + du);
-                        if ((visited[v + height] & (1ULL << (u + du))) != 0) {
-                            can_expand = false;
-                            break;
-                        }
-                        if (!(slice[check_index] == start_data)) {
-                            can_expand = false;
+                        if (!(slice[(v + height) * SIZE + u + du] == start_data)) {
+                            row_matches = false;
                             break;
                         }
                     }
-                    if (can_expand) ++height;
+                    if (!row_matches) {
+                        break;
+                    }
+                    ++height;
                 }
             }
 
-            // Mark as visited
+            // Consume the quad's cells
             for (std::uint32_t dv = 0; dv < height; ++dv) {
-                for (std::uint32_t du = 0; du < width; ++du) {
-                    visited[v + dv] |= (1ULL << (u + du));
-                }
+                occupancy[v + dv] &= ~run_mask;
             }
+            avail = occupancy[v];
 
             // Convert UV coordinates back to XYZ
             std::uint32_t x, y, z;
@@ -347,8 +834,8 @@ void MeshGenerator::greedy_mesh_slice(
                     break;
             }
 
-            // Add quad to mesh
-            add_face_quad(out_mesh, x, y, z, w, h, face, start_data);
+            // Add quad to the pass's stream
+            add_face_quad<Pass>(out_mesh, x, y, z, w, h, face, start_data);
         }
     }
 }
@@ -357,6 +844,29 @@ void MeshGenerator::greedy_mesh_slice(
 // QUAD GENERATION
 // =============================================================================
 
+void MeshGenerator::add_lod_face_quad(
+    ChunkMesh& mesh,
+    std::uint32_t x, std::uint32_t y, std::uint32_t z,
+    std::uint32_t step,
+    Face face,
+    const FaceData& data
+) {
+    // add_face_quad places positive faces one voxel above the base
+    // coordinate; shift the fixed axis so the plane lands on the coarse
+    // cell boundary instead of one voxel into the cell
+    const std::uint32_t shift = step - 1;
+    switch (face) {
+        case FACE_POS_X: x += shift; break;
+        case FACE_POS_Y: y += shift; break;
+        case FACE_POS_Z: z += shift; break;
+        default: break;
+    }
+    // LOD cells collapse everything into one coarse stream; at these
+    // distances translucent sorting is not worth a second pass
+    add_face_quad<MeshPass::OPAQUE>(mesh, x, y, z, step, step, face, data);
+}
+
+template <MeshGenerator::MeshPass Pass>
 void MeshGenerator::add_face_quad(
     ChunkMesh& mesh,
     std::uint32_t x, std::uint32_t y, std::uint32_t z,
@@ -490,7 +1000,11 @@ void MeshGenerator::add_face_quad(
     PackedVertex v2_vert(x2, y2, z2, normal, tex_layer, u2, v2, light, ao_packed);
     PackedVertex v3_vert(x3, y3, z3, normal, tex_layer, u3, v3, light, ao_packed);
 
-    mesh.add_quad(v0_vert, v1_vert, v2_vert, v3_vert);
+    if constexpr (Pass == MeshPass::OPAQUE) {
+        mesh.add_quad(v0_vert, v1_vert, v2_vert, v3_vert);
+    } else {
+        mesh.add_translucent_quad(v0_vert, v1_vert, v2_vert, v3_vert);
+    }
 }
 
 // =============================================================================
@@ -114,6 +114,260 @@ void PersistentBuffer::sync() {
     m_sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
 }
 
+// =============================================================================
+// STAGING RING
+// =============================================================================
+
+StagingRing::~StagingRing() {
+    destroy();
+}
+
+bool StagingRing::create(std::size_t region_size) {
+    destroy();
+
+    if (!m_buffer.create(GL_COPY_READ_BUFFER, region_size * REGION_COUNT)) {
+        return false;
+    }
+    m_region_size = region_size;
+    m_region = 0;
+    m_region_used = 0;
+    return true;
+}
+
+void StagingRing::destroy() {
+    for (void*& fence : m_fences) {
+        if (fence) {
+            glDeleteSync(static_cast<GLsync>(fence));
+            fence = nullptr;
+        }
+    }
+    m_buffer.destroy();
+    m_region_size = 0;
+    m_region = 0;
+    m_region_used = 0;
+}
+
+void StagingRing::begin_frame() {
+    m_region = (m_region + 1) % REGION_COUNT;
+    m_region_used = 0;
+
+    // The fence placed REGION_COUNT frames ago is almost always signaled
+    // by now; the wait only bites when the GPU is badly behind
+    if (m_fences[m_region]) {
+        GLenum wait_result = glClientWaitSync(
+            static_cast<GLsync>(m_fences[m_region]),
+            GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);  // 1 second timeout
+        if (wait_result == GL_WAIT_FAILED) {
+            std::cerr << "[StagingRing] Fence wait failed\n";
+        }
+        glDeleteSync(static_cast<GLsync>(m_fences[m_region]));
+        m_fences[m_region] = nullptr;
+    }
+}
+
+void StagingRing::end_frame() {
+    if (m_region_used == 0) {
+        return;  // Nothing staged this frame, no fence needed
+    }
+    if (m_fences[m_region]) {
+        glDeleteSync(static_cast<GLsync>(m_fences[m_region]));
+    }
+    m_fences[m_region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+std::size_t StagingRing::allocate(std::size_t bytes) {
+    // 64-byte aligned so copies start on cache-line boundaries
+    const std::size_t aligned = (m_region_used + 63) & ~std::size_t{63};
+    if (aligned + bytes > m_region_size) {
+        return INVALID_OFFSET;
+    }
+    m_region_used = aligned + bytes;
+    return static_cast<std::size_t>(m_region) * m_region_size + aligned;
+}
+
+void StagingRing::write(std::size_t offset, const void* data, std::size_t bytes) {
+    m_buffer.write(offset, data, bytes);
+}
+
+// =============================================================================
+// GPU PASS TIMERS
+// =============================================================================
+
+GpuPassTimers::~GpuPassTimers() {
+    destroy();
+}
+
+bool GpuPassTimers::create() {
+    for (auto& frame : m_queries) {
+        glCreateQueries(GL_TIME_ELAPSED, static_cast<GLsizei>(MAX_PASSES), frame.data());
+        for (std::uint32_t q : frame) {
+            if (q == 0) {
+                destroy();
+                return false;
+            }
+        }
+    }
+    m_frame = 0;
+    m_active_pass = MAX_PASSES;
+    m_valid = true;
+    return true;
+}
+
+void GpuPassTimers::destroy() {
+    for (auto& frame : m_queries) {
+        if (frame[0] != 0) {
+            glDeleteQueries(static_cast<GLsizei>(MAX_PASSES), frame.data());
+        }
+        frame.fill(0);
+    }
+    for (auto& frame : m_issued) {
+        frame.fill(false);
+    }
+    m_results_ms.fill(0.0f);
+    m_valid = false;
+}
+
+void GpuPassTimers::begin_frame() {
+    if (!m_valid) {
+        return;
+    }
+
+    // Reuse the oldest query set; its results are FRAMES_IN_FLIGHT
+    // frames old, so reading them back does not wait on the GPU
+    m_frame = (m_frame + 1) % FRAMES_IN_FLIGHT;
+    auto& queries = m_queries[m_frame];
+    auto& issued = m_issued[m_frame];
+
+    for (std::uint32_t pass = 0; pass < MAX_PASSES; ++pass) {
+        if (!issued[pass]) {
+            m_results_ms[pass] = 0.0f;
+            continue;
+        }
+        issued[pass] = false;
+
+        GLint available = 0;
+        glGetQueryObjectiv(queries[pass], GL_QUERY_RESULT_AVAILABLE, &available);
+        if (available == GL_FALSE) {
+            continue;  // Keep the previous value rather than stalling
+        }
+
+        GLuint64 elapsed_ns = 0;
+        glGetQueryObjectui64v(queries[pass], GL_QUERY_RESULT, &elapsed_ns);
+        m_results_ms[pass] = static_cast<float>(static_cast<double>(elapsed_ns) * 1e-6);
+    }
+}
+
+void GpuPassTimers::begin_pass(std::uint32_t pass) {
+    if (!m_valid || pass >= MAX_PASSES || m_active_pass != MAX_PASSES) {
+        return;
+    }
+    glBeginQuery(GL_TIME_ELAPSED, m_queries[m_frame][pass]);
+    m_active_pass = pass;
+}
+
+void GpuPassTimers::end_pass() {
+    if (!m_valid || m_active_pass == MAX_PASSES) {
+        return;
+    }
+    glEndQuery(GL_TIME_ELAPSED);
+    m_issued[m_frame][m_active_pass] = true;
+    m_active_pass = MAX_PASSES;
+}
+
+// =============================================================================
+// FREE-LIST ARENA
+// =============================================================================
+
+void FreeListArena::reset(std::uint32_t capacity) {
+    m_capacity = capacity;
+    m_used = 0;
+    m_free.clear();
+    if (capacity > 0) {
+        m_free.push_back(FreeRange{0, capacity});
+    }
+}
+
+std::uint32_t FreeListArena::allocate(std::uint32_t count) {
+    if (count == 0) {
+        return INVALID_OFFSET;
+    }
+
+    // First fit: free list is sorted by offset, so this also keeps
+    // allocations packed toward the front of the pool
+    for (std::size_t i = 0; i < m_free.size(); ++i) {
+        FreeRange& range = m_free[i];
+        if (range.count < count) {
+            continue;
+        }
+
+        const std::uint32_t offset = range.offset;
+        if (range.count == count) {
+            m_free.erase(m_free.begin() + static_cast<std::ptrdiff_t>(i));
+        } else {
+            range.offset += count;
+            range.count -= count;
+        }
+        m_used += count;
+        return offset;
+    }
+
+    return INVALID_OFFSET;
+}
+
+void FreeListArena::release(std::uint32_t offset, std::uint32_t count) {
+    if (count == 0) {
+        return;
+    }
+
+    // Insert sorted by offset
+    auto it = std::lower_bound(
+        m_free.begin(), m_free.end(), offset,
+        [](const FreeRange& range, std::uint32_t value) { return range.offset < value; });
+    it = m_free.insert(it, FreeRange{offset, count});
+
+    // Merge with successor
+    auto next = it + 1;
+    if (next != m_free.end() && it->offset + it->count == next->offset) {
+        it->count += next->count;
+        m_free.erase(next);
+    }
+
+    // Merge with predecessor
+    if (it != m_free.begin()) {
+        auto prev = it - 1;
+        if (prev->offset + prev->count == it->offset) {
+            prev->count += it->count;
+            m_free.erase(it);
+        }
+    }
+
+    m_used -= count;
+}
+
+// =============================================================================
+// CULLING HELPERS
+// =============================================================================
+
+namespace {
+
+// Super-cell containing a chunk (arithmetic shift floors negatives)
+[[nodiscard]] ChunkPosition super_cell_of(const ChunkPosition& pos) noexcept {
+    return ChunkPosition{pos.x >> 2, pos.y >> 2, pos.z >> 2};
+}
+
+// AABB of an axis-aligned box of chunks, relative to the render origin
+[[nodiscard]] math::Vec3 box_corner(
+    ChunkCoord cx, ChunkCoord cy, ChunkCoord cz,
+    const WorldPosition& origin) noexcept {
+    return math::Vec3{
+        static_cast<float>(static_cast<double>(cx * static_cast<ChunkCoord>(CHUNK_SIZE_X)) - origin.x),
+        static_cast<float>(static_cast<double>(cy * static_cast<ChunkCoord>(CHUNK_SIZE_Y)) - origin.y),
+        static_cast<float>(static_cast<double>(cz * static_cast<ChunkCoord>(CHUNK_SIZE_Z)) - origin.z)
+    };
+}
+
+} // namespace
+
 // =============================================================================
 // RENDERER
 // =============================================================================
@@ -147,6 +401,12 @@ bool Renderer::initialize() {
         return false;
     }
 
+    // Create pooled mesh arena (vertex/index pools + shared VAO)
+    if (!create_arena_resources()) {
+        std::cerr << "[Renderer] Failed to create mesh arena\n";
+        return false;
+    }
+
     // Create indirect draw buffer
     std::size_t indirect_buffer_size = MAX_DRAW_COMMANDS * sizeof(DrawElementsIndirectCommand);
     if (!m_indirect_buffer.create(GL_DRAW_INDIRECT_BUFFER, indirect_buffer_size)) {
@@ -154,6 +414,24 @@ bool Renderer::initialize() {
         return false;
     }
 
+    // Staging ring is optional: uploads fall back to the direct
+    // glNamedBufferSubData path if it cannot be created
+    if (!m_staging.create(STAGING_REGION_BYTES)) {
+        std::cerr << "[Renderer] Staging ring unavailable, direct uploads\n";
+    }
+
+    // GPU pass timers are optional: the overlay just shows zeros
+    if (!m_gpu_timers.create()) {
+        std::cerr << "[Renderer] GPU timer queries unavailable\n";
+    }
+
+    // Hi-Z occlusion pass is optional: fall back to frustum-only culling
+    // if the compute shaders do not build on this driver
+    m_occlusion_supported = create_occlusion_resources();
+    if (!m_occlusion_supported) {
+        std::cerr << "[Renderer] Occlusion culling unavailable, frustum-only\n";
+    }
+
     // Create default 1x1 white texture (fallback)
     glCreateTextures(GL_TEXTURE_2D, 1, &m_default_texture);
     if (m_default_texture == 0) {
@@ -199,6 +477,41 @@ void Renderer::shutdown() {
         m_default_texture = 0;
     }
 
+    // Destroy occlusion resources
+    if (m_scene_depth != 0) {
+        glDeleteTextures(1, &m_scene_depth);
+        m_scene_depth = 0;
+    }
+    if (m_depth_pyramid != 0) {
+        glDeleteTextures(1, &m_depth_pyramid);
+        m_depth_pyramid = 0;
+    }
+    if (m_bounds_buffer != 0) {
+        glDeleteBuffers(1, &m_bounds_buffer);
+        m_bounds_buffer = 0;
+    }
+    m_pyramid_valid = false;
+
+    // Destroy mesh arena
+    if (m_arena_vao != 0) {
+        glDeleteVertexArrays(1, &m_arena_vao);
+        m_arena_vao = 0;
+    }
+    if (m_vertex_pool != 0) {
+        glDeleteBuffers(1, &m_vertex_pool);
+        m_vertex_pool = 0;
+    }
+    if (m_index_pool != 0) {
+        glDeleteBuffers(1, &m_index_pool);
+        m_index_pool = 0;
+    }
+    if (m_offset_buffer != 0) {
+        glDeleteBuffers(1, &m_offset_buffer);
+        m_offset_buffer = 0;
+    }
+
+    m_staging.destroy();
+    m_gpu_timers.destroy();
     m_indirect_buffer.destroy();
     m_initialized = false;
 }
@@ -239,9 +552,31 @@ void Renderer::begin_frame() {
 
     m_draw_calls = 0;
     m_meshes_rebuilt = 0;
+    m_chunks_culled = 0;
+
+    // Rotate mesh-upload staging to the region fenced three frames ago
+    if (m_staging.is_valid()) {
+        m_staging.begin_frame();
+    }
+
+    // Rotate GPU timer queries and harvest last-completed results
+    m_gpu_timers.begin_frame();
 }
 
 void Renderer::end_frame() {
+    // Capture this frame's depth into the Hi-Z pyramid for next frame
+    if (m_occlusion_enabled && m_occlusion_supported && m_draw_calls > 0) {
+        m_gpu_timers.begin_pass(static_cast<std::uint32_t>(GpuPass::DEPTH_PYRAMID));
+        capture_depth_pyramid();
+        m_gpu_timers.end_pass();
+    }
+
+    // Fence this frame's staged uploads so the region is not rewritten
+    // while the GPU still reads from it
+    if (m_staging.is_valid()) {
+        m_staging.end_frame();
+    }
+
     // Sync indirect buffer if used
     if (m_draw_calls > 0) {
         m_indirect_buffer.sync();
@@ -257,6 +592,7 @@ void Renderer::set_camera(const Camera& camera) {
     m_projection_matrix = camera.projection_matrix();
     m_view_projection = camera.view_projection_matrix();
     m_render_origin = camera.render_origin();
+    m_frustum.extract(m_view_projection);
 }
 
 // =============================================================================
@@ -280,20 +616,67 @@ bool Renderer::upload_chunk_mesh(const ChunkPosition& pos, const ChunkMesh& mesh
 
     ChunkGPUData gpu_data;
     gpu_data.position = pos;
+    gpu_data.vertex_count = static_cast<std::uint32_t>(mesh.vertices.size());
+    gpu_data.index_count = static_cast<std::uint32_t>(mesh.indices.size());
+    gpu_data.translucent_vertex_count = static_cast<std::uint32_t>(mesh.translucent_vertices.size());
+    gpu_data.translucent_index_count = static_cast<std::uint32_t>(mesh.translucent_indices.size());
+
+    // Sub-allocate both streams' ranges from the pooled arenas (counts
+    // may be zero: a water surface chunk can be translucent-only)
+    const auto allocate_stream = [this](std::uint32_t vertex_count, std::uint32_t index_count,
+                                        std::uint32_t& vertex_offset, std::uint32_t& index_offset) {
+        vertex_offset = 0;
+        index_offset = 0;
+        if (vertex_count > 0) {
+            vertex_offset = m_vertex_arena.allocate(vertex_count);
+            if (vertex_offset == FreeListArena::INVALID_OFFSET) {
+                std::cerr << "[Renderer] Vertex arena full ("
+                          << m_vertex_arena.used() << "/" << m_vertex_arena.capacity() << ")\n";
+                return false;
+            }
+        }
+        if (index_count > 0) {
+            index_offset = m_index_arena.allocate(index_count);
+            if (index_offset == FreeListArena::INVALID_OFFSET) {
+                std::cerr << "[Renderer] Index arena full ("
+                          << m_index_arena.used() << "/" << m_index_arena.capacity() << ")\n";
+                if (vertex_count > 0) {
+                    m_vertex_arena.release(vertex_offset, vertex_count);
+                }
+                return false;
+            }
+        }
+        return true;
+    };
 
-    if (!create_chunk_vao(gpu_data, mesh)) {
-        LOG("Upload", "  ERROR: Failed to create VAO");
+    if (!allocate_stream(gpu_data.vertex_count, gpu_data.index_count,
+                         gpu_data.vertex_offset, gpu_data.index_offset)) {
+        return false;
+    }
+    if (!allocate_stream(gpu_data.translucent_vertex_count, gpu_data.translucent_index_count,
+                         gpu_data.translucent_vertex_offset, gpu_data.translucent_index_offset)) {
+        if (gpu_data.vertex_count > 0) {
+            m_vertex_arena.release(gpu_data.vertex_offset, gpu_data.vertex_count);
+        }
+        if (gpu_data.index_count > 0) {
+            m_index_arena.release(gpu_data.index_offset, gpu_data.index_count);
+        }
         return false;
     }
 
+    gpu_data.valid = true;
+    upload_chunk_ranges(gpu_data, mesh);
+
     m_chunks[pos] = gpu_data;
+    m_super_cells[super_cell_of(pos)].push_back(pos);
 
     // Update stats
-    m_total_vertices += gpu_data.vertex_count;
-    m_total_indices += gpu_data.index_count;
+    m_total_vertices += gpu_data.vertex_count + gpu_data.translucent_vertex_count;
+    m_total_indices += gpu_data.index_count + gpu_data.translucent_index_count;
     ++m_meshes_rebuilt;
 
-    LOG("Upload", "  Upload successful: VAO=", gpu_data.vao, " VBO=", gpu_data.vbo, " EBO=", gpu_data.ebo);
+    LOG("Upload", "  Upload successful: voffset=", gpu_data.vertex_offset,
+        " ioffset=", gpu_data.index_offset);
 
     return true;
 }
@@ -301,10 +684,19 @@ bool Renderer::upload_chunk_mesh(const ChunkPosition& pos, const ChunkMesh& mesh
 void Renderer::remove_chunk_mesh(const ChunkPosition& pos) {
     auto it = m_chunks.find(pos);
     if (it != m_chunks.end()) {
-        m_total_vertices -= it->second.vertex_count;
-        m_total_indices -= it->second.index_count;
+        m_total_vertices -= it->second.vertex_count + it->second.translucent_vertex_count;
+        m_total_indices -= it->second.index_count + it->second.translucent_index_count;
         destroy_chunk_data(it->second);
         m_chunks.erase(it);
+
+        auto cell_it = m_super_cells.find(super_cell_of(pos));
+        if (cell_it != m_super_cells.end()) {
+            auto& members = cell_it->second;
+            members.erase(std::remove(members.begin(), members.end(), pos), members.end());
+            if (members.empty()) {
+                m_super_cells.erase(cell_it);
+            }
+        }
     }
 }
 
@@ -312,86 +704,134 @@ bool Renderer::has_chunk_mesh(const ChunkPosition& pos) const {
     return m_chunks.find(pos) != m_chunks.end();
 }
 
-bool Renderer::create_chunk_vao(ChunkGPUData& gpu_data, const ChunkMesh& mesh) {
-    LOG("VAO", "Creating VAO for ", mesh.vertices.size(), " vertices, ", mesh.indices.size(), " indices");
-
-    // Create VAO
-    glCreateVertexArrays(1, &gpu_data.vao);
-    if (gpu_data.vao == 0) {
-        LOG("VAO", "ERROR: glCreateVertexArrays failed");
+bool Renderer::create_arena_resources() {
+    // Vertex pool (DYNAMIC_STORAGE so chunk ranges can be re-written in place)
+    glCreateBuffers(1, &m_vertex_pool);
+    glNamedBufferStorage(
+        m_vertex_pool,
+        static_cast<GLsizeiptr>(static_cast<std::size_t>(VERTEX_POOL_CAPACITY) * sizeof(PackedVertex)),
+        nullptr, GL_DYNAMIC_STORAGE_BIT);
+
+    // Index pool
+    glCreateBuffers(1, &m_index_pool);
+    glNamedBufferStorage(
+        m_index_pool,
+        static_cast<GLsizeiptr>(static_cast<std::size_t>(INDEX_POOL_CAPACITY) * sizeof(std::uint32_t)),
+        nullptr, GL_DYNAMIC_STORAGE_BIT);
+
+    // Per-draw chunk offsets (re-uploaded every frame, one vec3 per command)
+    glCreateBuffers(1, &m_offset_buffer);
+    glNamedBufferStorage(
+        m_offset_buffer,
+        static_cast<GLsizeiptr>(MAX_DRAW_COMMANDS * sizeof(math::Vec3)),
+        nullptr, GL_DYNAMIC_STORAGE_BIT);
+
+    // One VAO for every chunk draw
+    glCreateVertexArrays(1, &m_arena_vao);
+    if (m_arena_vao == 0 || m_vertex_pool == 0 || m_index_pool == 0 || m_offset_buffer == 0) {
         return false;
     }
-    LOG("VAO", "Created VAO: ", gpu_data.vao);
-
-    // Create VBO for vertices
-    glCreateBuffers(1, &gpu_data.vbo);
-    GLsizeiptr vbo_size = static_cast<GLsizeiptr>(mesh.vertices.size() * sizeof(PackedVertex));
-    glNamedBufferStorage(gpu_data.vbo, vbo_size, mesh.vertices.data(), 0);
-    LOG("VAO", "Created VBO: ", gpu_data.vbo, " size=", vbo_size, " bytes");
-
-    // Log first few vertices raw data
-    for (std::size_t i = 0; i < std::min<std::size_t>(4, mesh.vertices.size()); ++i) {
-        LOG("VAO", "  V", i, " data1=0x", std::hex, mesh.vertices[i].data1, " data2=0x", mesh.vertices[i].data2, std::dec);
-    }
-
-    // Create EBO for indices
-    glCreateBuffers(1, &gpu_data.ebo);
-    GLsizeiptr ebo_size = static_cast<GLsizeiptr>(mesh.indices.size() * sizeof(std::uint32_t));
-    glNamedBufferStorage(gpu_data.ebo, ebo_size, mesh.indices.data(), 0);
-    LOG("VAO", "Created EBO: ", gpu_data.ebo, " size=", ebo_size, " bytes");
-
-    // Log first few indices
-    LOG("VAO", "First indices: ", mesh.indices[0], ", ", mesh.indices[1], ", ", mesh.indices[2], ", ",
-                                  mesh.indices[3], ", ", mesh.indices[4], ", ", mesh.indices[5]);
 
-    // Setup VAO attributes
-    // Attribute 0: data1 (uint32)
-    glEnableVertexArrayAttrib(gpu_data.vao, 0);
-    glVertexArrayAttribIFormat(gpu_data.vao, 0, 1, GL_UNSIGNED_INT, offsetof(PackedVertex, data1));
-    glVertexArrayAttribBinding(gpu_data.vao, 0, 0);
-    LOG("VAO", "Attrib 0: IFormat size=1 type=UINT offset=", offsetof(PackedVertex, data1));
+    // Attribute 0: data1 (uint32), attribute 1: data2 (uint32)
+    glEnableVertexArrayAttrib(m_arena_vao, 0);
+    glVertexArrayAttribIFormat(m_arena_vao, 0, 1, GL_UNSIGNED_INT, offsetof(PackedVertex, data1));
+    glVertexArrayAttribBinding(m_arena_vao, 0, 0);
 
-    // Attribute 1: data2 (uint32)
-    glEnableVertexArrayAttrib(gpu_data.vao, 1);
-    glVertexArrayAttribIFormat(gpu_data.vao, 1, 1, GL_UNSIGNED_INT, offsetof(PackedVertex, data2));
-    glVertexArrayAttribBinding(gpu_data.vao, 1, 0);
-    LOG("VAO", "Attrib 1: IFormat size=1 type=UINT offset=", offsetof(PackedVertex, data2));
+    glEnableVertexArrayAttrib(m_arena_vao, 1);
+    glVertexArrayAttribIFormat(m_arena_vao, 1, 1, GL_UNSIGNED_INT, offsetof(PackedVertex, data2));
+    glVertexArrayAttribBinding(m_arena_vao, 1, 0);
 
-    // Bind VBO to binding point 0
-    glVertexArrayVertexBuffer(gpu_data.vao, 0, gpu_data.vbo, 0, sizeof(PackedVertex));
-    LOG("VAO", "Bound VBO to binding point 0, stride=", sizeof(PackedVertex));
+    // Attribute 2: chunk offset, advancing per instance - each indirect
+    // command picks its slot via base_instance
+    glEnableVertexArrayAttrib(m_arena_vao, 2);
+    glVertexArrayAttribFormat(m_arena_vao, 2, 3, GL_FLOAT, GL_FALSE, 0);
+    glVertexArrayAttribBinding(m_arena_vao, 2, 1);
+    glVertexArrayBindingDivisor(m_arena_vao, 1, 1);
 
-    // Bind EBO
-    glVertexArrayElementBuffer(gpu_data.vao, gpu_data.ebo);
-    LOG("VAO", "Bound EBO to VAO");
+    glVertexArrayVertexBuffer(m_arena_vao, 0, m_vertex_pool, 0, sizeof(PackedVertex));
+    glVertexArrayVertexBuffer(m_arena_vao, 1, m_offset_buffer, 0, sizeof(math::Vec3));
+    glVertexArrayElementBuffer(m_arena_vao, m_index_pool);
 
-    gpu_data.vertex_count = static_cast<std::uint32_t>(mesh.vertices.size());
-    gpu_data.index_count = static_cast<std::uint32_t>(mesh.indices.size());
-    gpu_data.valid = true;
+    m_vertex_arena.reset(VERTEX_POOL_CAPACITY);
+    m_index_arena.reset(INDEX_POOL_CAPACITY);
 
-    // Check for errors
     GLenum err = glGetError();
     if (err != GL_NO_ERROR) {
-        LOG("VAO", "OpenGL ERROR: ", err);
+        std::cerr << "[Renderer] OpenGL error creating arena: " << err << "\n";
         return false;
     }
 
-    LOG("VAO", "VAO creation successful");
+    std::cout << "[Renderer] Mesh arena: "
+              << (static_cast<std::size_t>(VERTEX_POOL_CAPACITY) * sizeof(PackedVertex)) / (1024 * 1024)
+              << " MiB vertices, "
+              << (static_cast<std::size_t>(INDEX_POOL_CAPACITY) * sizeof(std::uint32_t)) / (1024 * 1024)
+              << " MiB indices\n";
     return true;
 }
 
+void Renderer::upload_chunk_ranges(const ChunkGPUData& gpu_data, const ChunkMesh& mesh) {
+    const auto upload_stream = [this](const std::vector<PackedVertex>& vertices,
+                                      const std::vector<std::uint32_t>& indices,
+                                      std::uint32_t vertex_offset, std::uint32_t index_offset) {
+        if (vertices.empty()) {
+            return;
+        }
+        const std::size_t vertex_bytes = vertices.size() * sizeof(PackedVertex);
+        const std::size_t index_bytes = indices.size() * sizeof(std::uint32_t);
+        const GLintptr vertex_dst = static_cast<GLintptr>(
+            static_cast<std::size_t>(vertex_offset) * sizeof(PackedVertex));
+        const GLintptr index_dst = static_cast<GLintptr>(
+            static_cast<std::size_t>(index_offset) * sizeof(std::uint32_t));
+
+        // Preferred path: memcpy into the persistent mapping and let the GPU
+        // copy into the pools. glNamedBufferSubData on an in-use pool can
+        // stall the driver for milliseconds; the staged copy never does.
+        if (m_staging.is_valid()) {
+            const std::size_t vertex_src = m_staging.allocate(vertex_bytes);
+            const std::size_t index_src = m_staging.allocate(index_bytes);
+            if (vertex_src != StagingRing::INVALID_OFFSET &&
+                index_src != StagingRing::INVALID_OFFSET) {
+                m_staging.write(vertex_src, vertices.data(), vertex_bytes);
+                m_staging.write(index_src, indices.data(), index_bytes);
+                glCopyNamedBufferSubData(
+                    m_staging.id(), m_vertex_pool,
+                    static_cast<GLintptr>(vertex_src), vertex_dst,
+                    static_cast<GLsizeiptr>(vertex_bytes));
+                glCopyNamedBufferSubData(
+                    m_staging.id(), m_index_pool,
+                    static_cast<GLintptr>(index_src), index_dst,
+                    static_cast<GLsizeiptr>(index_bytes));
+                return;
+            }
+            // Region exhausted this frame - fall through to the direct path
+        }
+
+        glNamedBufferSubData(m_vertex_pool, vertex_dst,
+                             static_cast<GLsizeiptr>(vertex_bytes), vertices.data());
+        glNamedBufferSubData(m_index_pool, index_dst,
+                             static_cast<GLsizeiptr>(index_bytes), indices.data());
+    };
+
+    upload_stream(mesh.vertices, mesh.indices,
+                  gpu_data.vertex_offset, gpu_data.index_offset);
+    upload_stream(mesh.translucent_vertices, mesh.translucent_indices,
+                  gpu_data.translucent_vertex_offset, gpu_data.translucent_index_offset);
+}
+
 void Renderer::destroy_chunk_data(ChunkGPUData& data) {
-    if (data.vao != 0) {
-        glDeleteVertexArrays(1, &data.vao);
-        data.vao = 0;
-    }
-    if (data.vbo != 0) {
-        glDeleteBuffers(1, &data.vbo);
-        data.vbo = 0;
-    }
-    if (data.ebo != 0) {
-        glDeleteBuffers(1, &data.ebo);
-        data.ebo = 0;
+    if (data.valid) {
+        if (data.vertex_count > 0) {
+            m_vertex_arena.release(data.vertex_offset, data.vertex_count);
+        }
+        if (data.index_count > 0) {
+            m_index_arena.release(data.index_offset, data.index_count);
+        }
+        if (data.translucent_vertex_count > 0) {
+            m_vertex_arena.release(data.translucent_vertex_offset, data.translucent_vertex_count);
+        }
+        if (data.translucent_index_count > 0) {
+            m_index_arena.release(data.translucent_index_offset, data.translucent_index_count);
+        }
     }
     data.valid = false;
 }
@@ -485,66 +925,75 @@ void Renderer::render_chunks() {
 
     static bool first_render = true;
 
-    // Render each chunk
-    for (const auto& [pos, gpu_data] : m_chunks) {
-        if (!gpu_data.valid || gpu_data.index_count == 0) {
-            if (first_render) {
-                LOG("Render", "Skipping invalid chunk at (", pos.x, ",", pos.y, ",", pos.z, ")");
-            }
-            continue;
-        }
+    // Build the indirect command list for this frame
+    DrawBatch& batch = m_draw_batch;
+    build_draw_batch(batch, math::Vec3{});
 
-        // Calculate chunk offset relative to render origin
-        float chunk_offset_x = static_cast<float>(static_cast<double>(pos.x * static_cast<std::int32_t>(CHUNK_SIZE_X)) - m_render_origin.x);
-        float chunk_offset_y = static_cast<float>(static_cast<double>(pos.y * static_cast<std::int32_t>(CHUNK_SIZE_Y)) - m_render_origin.y);
-        float chunk_offset_z = static_cast<float>(static_cast<double>(pos.z * static_cast<std::int32_t>(CHUNK_SIZE_Z)) - m_render_origin.z);
-
-        if (first_render) {
-            LOG("Render", "Chunk (", pos.x, ",", pos.y, ",", pos.z, "):");
-            LOG("Render", "  VAO=", gpu_data.vao, " VBO=", gpu_data.vbo, " EBO=", gpu_data.ebo);
-            LOG("Render", "  Vertices=", gpu_data.vertex_count, " Indices=", gpu_data.index_count);
-            LOG("Render", "  Offset=(", chunk_offset_x, ",", chunk_offset_y, ",", chunk_offset_z, ")");
-            LOG("Render", "  Render origin=(", m_render_origin.x, ",", m_render_origin.y, ",", m_render_origin.z, ")");
-        }
+    if (batch.commands.empty() && batch.translucent_commands.empty()) {
+        Shader::unbind();
+        return;
+    }
 
-        // Set chunk offset uniform (location 1)
-        Shader::set_vec3(1, chunk_offset_x, chunk_offset_y, chunk_offset_z);
+    // Write both command lists into the persistent-mapped indirect
+    // buffer (translucent packed right after opaque) and the per-draw
+    // chunk offsets into the instanced attribute buffer
+    const std::size_t opaque_bytes =
+        batch.commands.size() * sizeof(DrawElementsIndirectCommand);
+    if (!batch.commands.empty()) {
+        m_indirect_buffer.write(0, batch.commands.data(), opaque_bytes);
+    }
+    if (!batch.translucent_commands.empty()) {
+        m_indirect_buffer.write(
+            opaque_bytes, batch.translucent_commands.data(),
+            batch.translucent_commands.size() * sizeof(DrawElementsIndirectCommand));
+    }
 
-        // Bind VAO and draw
-        glBindVertexArray(gpu_data.vao);
-        
-        if (first_render) {
-            // Verify VAO binding
-            GLint current_vao = 0;
-            glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &current_vao);
-            LOG("Render", "  Bound VAO: ", current_vao, " (expected ", gpu_data.vao, ")");
-            
-            // Verify EBO binding
-            GLint current_ebo = 0;
-            glGetIntegerv(GL_ELEMENT_ARRAY_BUFFER_BINDING, &current_ebo);
-            LOG("Render", "  Bound EBO: ", current_ebo, " (expected ", gpu_data.ebo, ")");
-        }
+    glNamedBufferSubData(
+        m_offset_buffer, 0,
+        static_cast<GLsizeiptr>(batch.chunk_offsets.size() * sizeof(math::Vec3)),
+        batch.chunk_offsets.data());
 
-        glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(gpu_data.index_count), GL_UNSIGNED_INT, nullptr);
+    if (first_render) {
+        LOG("Render", "Indirect batch: ", batch.commands.size(), " commands, ",
+            m_vertex_arena.used(), "/", m_vertex_arena.capacity(), " pool vertices");
+        first_render = false;
+    }
 
-        if (first_render) {
-            // Check for OpenGL errors
-            GLenum err = glGetError();
-            if (err != GL_NO_ERROR) {
-                LOG("Render", "  OpenGL ERROR after draw: ", err);
-            } else {
-                LOG("Render", "  Draw call succeeded");
-            }
-        }
+    // GPU occlusion: test batch AABBs against last frame's depth pyramid
+    // and zero out hidden draws in place
+    if (m_occlusion_enabled && m_occlusion_supported && m_pyramid_valid) {
+        m_gpu_timers.begin_pass(static_cast<std::uint32_t>(GpuPass::OCCLUSION));
+        dispatch_occlusion_cull(batch);
+        m_gpu_timers.end_pass();
+        m_chunk_shader.bind();
+        Shader::set_mat4(0, m_view_projection);
+    }
 
+    // One multi-draw per stream: depth-writing opaque front-to-back,
+    // then blended translucent back-to-front reading (but not writing)
+    // depth so geometry behind water still occludes correctly
+    glBindVertexArray(m_arena_vao);
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, m_indirect_buffer.id());
+
+    m_gpu_timers.begin_pass(static_cast<std::uint32_t>(GpuPass::CHUNKS));
+    if (!batch.commands.empty()) {
+        glMultiDrawElementsIndirect(
+            GL_TRIANGLES, GL_UNSIGNED_INT, nullptr,
+            static_cast<GLsizei>(batch.commands.size()), 0);
         ++m_draw_calls;
     }
-
-    if (first_render) {
-        LOG("Render", "Total draw calls: ", m_draw_calls);
-        first_render = false;
+    if (!batch.translucent_commands.empty()) {
+        glDepthMask(GL_FALSE);
+        glMultiDrawElementsIndirect(
+            GL_TRIANGLES, GL_UNSIGNED_INT,
+            reinterpret_cast<const void*>(opaque_bytes),
+            static_cast<GLsizei>(batch.translucent_commands.size()), 0);
+        glDepthMask(GL_TRUE);
+        ++m_draw_calls;
     }
+    m_gpu_timers.end_pass();
 
+    glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
     glBindVertexArray(0);
     Shader::unbind();
 }
@@ -562,15 +1011,22 @@ void Renderer::render_chunk(const ChunkPosition& pos) {
     // Set view-projection matrix
     Shader::set_mat4(0, m_view_projection);
 
-    // Calculate chunk offset
-    float chunk_offset_x = static_cast<float>(static_cast<double>(pos.x * static_cast<std::int32_t>(CHUNK_SIZE_X)) - m_render_origin.x);
-    float chunk_offset_y = static_cast<float>(static_cast<double>(pos.y * static_cast<std::int32_t>(CHUNK_SIZE_Y)) - m_render_origin.y);
-    float chunk_offset_z = static_cast<float>(static_cast<double>(pos.z * static_cast<std::int32_t>(CHUNK_SIZE_Z)) - m_render_origin.z);
-
-    Shader::set_vec3(1, chunk_offset_x, chunk_offset_y, chunk_offset_z);
-
-    glBindVertexArray(gpu_data.vao);
-    glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(gpu_data.index_count), GL_UNSIGNED_INT, nullptr);
+    // Write the chunk offset into instance slot 0
+    math::Vec3 offset;
+    offset.x = static_cast<float>(static_cast<double>(pos.x * static_cast<std::int32_t>(CHUNK_SIZE_X)) - m_render_origin.x);
+    offset.y = static_cast<float>(static_cast<double>(pos.y * static_cast<std::int32_t>(CHUNK_SIZE_Y)) - m_render_origin.y);
+    offset.z = static_cast<float>(static_cast<double>(pos.z * static_cast<std::int32_t>(CHUNK_SIZE_Z)) - m_render_origin.z);
+    glNamedBufferSubData(m_offset_buffer, 0, sizeof(math::Vec3), &offset);
+
+    glBindVertexArray(m_arena_vao);
+    glDrawElementsInstancedBaseVertexBaseInstance(
+        GL_TRIANGLES,
+        static_cast<GLsizei>(gpu_data.index_count),
+        GL_UNSIGNED_INT,
+        reinterpret_cast<const void*>(static_cast<std::size_t>(gpu_data.index_offset) * sizeof(std::uint32_t)),
+        1,
+        static_cast<GLint>(gpu_data.vertex_offset),
+        0);
 
     glBindVertexArray(0);
     Shader::unbind();
@@ -581,40 +1037,281 @@ void Renderer::render_chunk(const ChunkPosition& pos) {
 void Renderer::build_draw_batch(DrawBatch& batch, const math::Vec3& /*camera_pos*/) {
     batch.commands.clear();
     batch.chunk_offsets.clear();
+    batch.bounds.clear();
+    batch.translucent_commands.clear();
     batch.commands.reserve(m_chunks.size());
     batch.chunk_offsets.reserve(m_chunks.size());
+    batch.bounds.reserve(m_chunks.size() * 8);
+
+    m_visible_opaque.clear();
+    m_visible_translucent.clear();
+
+    // Frustum survivors are collected with their camera distance first,
+    // then sorted and turned into commands: opaque near-first so early-z
+    // kills hidden fragments, translucent far-first so blending composes
+    // in depth order
+    const auto collect = [this](const ChunkPosition& pos, const ChunkGPUData& gpu_data) {
+        const math::Vec3 bmin = box_corner(pos.x, pos.y, pos.z, m_render_origin);
+        const math::Vec3 bmax = box_corner(pos.x + 1, pos.y + 1, pos.z + 1, m_render_origin);
+        const float cx = (bmin.x + bmax.x) * 0.5f;
+        const float cy = (bmin.y + bmax.y) * 0.5f;
+        const float cz = (bmin.z + bmax.z) * 0.5f;
+        // Bounds are camera-relative, so the center is the distance
+        const float distance_sq = cx * cx + cy * cy + cz * cz;
+
+        if (gpu_data.index_count > 0) {
+            m_visible_opaque.push_back({&gpu_data, distance_sq});
+        }
+        if (gpu_data.translucent_index_count > 0) {
+            m_visible_translucent.push_back({&gpu_data, distance_sq});
+        }
+    };
 
-    std::uint32_t base_vertex = 0;
-    std::uint32_t base_index = 0;
-
-    for (const auto& [pos, gpu_data] : m_chunks) {
-        if (!gpu_data.valid || gpu_data.index_count == 0) {
+    // Coarse pass: one frustum test per 4x4x4 super-cell
+    for (const auto& [cell_pos, members] : m_super_cells) {
+        const math::Vec3 cell_min = box_corner(
+            cell_pos.x << SUPER_CELL_SHIFT,
+            cell_pos.y << SUPER_CELL_SHIFT,
+            cell_pos.z << SUPER_CELL_SHIFT,
+            m_render_origin);
+        const math::Vec3 cell_max = box_corner(
+            (cell_pos.x + 1) << SUPER_CELL_SHIFT,
+            (cell_pos.y + 1) << SUPER_CELL_SHIFT,
+            (cell_pos.z + 1) << SUPER_CELL_SHIFT,
+            m_render_origin);
+
+        const Frustum::Containment cell_result = m_frustum.classify_aabb(cell_min, cell_max);
+        if (cell_result == Frustum::Containment::OUTSIDE) {
+            m_chunks_culled += members.size();
             continue;
         }
 
-        // TODO: Frustum culling here
+        const bool cell_fully_inside = (cell_result == Frustum::Containment::INSIDE);
+
+        for (const ChunkPosition& pos : members) {
+            auto it = m_chunks.find(pos);
+            if (it == m_chunks.end() || !it->second.valid ||
+                (it->second.index_count == 0 && it->second.translucent_index_count == 0)) {
+                continue;
+            }
+
+            // Fine pass: per-chunk AABB, skipped when the cell is fully inside
+            if (!cell_fully_inside) {
+                const math::Vec3 chunk_min = box_corner(pos.x, pos.y, pos.z, m_render_origin);
+                const math::Vec3 chunk_max = box_corner(pos.x + 1, pos.y + 1, pos.z + 1, m_render_origin);
+                if (!m_frustum.intersects_aabb(chunk_min, chunk_max)) {
+                    ++m_chunks_culled;
+                    continue;
+                }
+            }
+
+            collect(pos, it->second);
+        }
+    }
+
+    std::sort(m_visible_opaque.begin(), m_visible_opaque.end(),
+              [](const VisibleChunk& a, const VisibleChunk& b) {
+                  return a.distance_sq < b.distance_sq;
+              });
+    std::sort(m_visible_translucent.begin(), m_visible_translucent.end(),
+              [](const VisibleChunk& a, const VisibleChunk& b) {
+                  return a.distance_sq > b.distance_sq;
+              });
+
+    // Both lists share the indirect and offset buffers, so the command
+    // cap applies to their sum; commands pick their offset slot via
+    // base_instance
+    const auto emit = [this, &batch](const ChunkGPUData& gpu_data,
+                                     std::uint32_t index_count,
+                                     std::uint32_t index_offset,
+                                     std::uint32_t vertex_offset,
+                                     std::vector<DrawElementsIndirectCommand>& commands) {
+        if (batch.chunk_offsets.size() >= MAX_DRAW_COMMANDS) {
+            return;
+        }
+        const ChunkPosition& pos = gpu_data.position;
 
         DrawElementsIndirectCommand cmd;
-        cmd.count = gpu_data.index_count;
+        cmd.count = index_count;
         cmd.instance_count = 1;
-        cmd.first_index = base_index;
-        cmd.base_vertex = base_vertex;
-        cmd.base_instance = static_cast<std::uint32_t>(batch.commands.size());
+        cmd.first_index = index_offset;
+        cmd.base_vertex = static_cast<std::int32_t>(vertex_offset);
+        cmd.base_instance = static_cast<std::uint32_t>(batch.chunk_offsets.size());
 
-        batch.commands.push_back(cmd);
+        commands.push_back(cmd);
+        batch.chunk_offsets.push_back(box_corner(pos.x, pos.y, pos.z, m_render_origin));
+    };
 
-        // Calculate chunk offset
-        math::Vec3 offset;
-        offset.x = static_cast<float>(static_cast<double>(pos.x * static_cast<std::int32_t>(CHUNK_SIZE_X)) - m_render_origin.x);
-        offset.y = static_cast<float>(static_cast<double>(pos.y * static_cast<std::int32_t>(CHUNK_SIZE_Y)) - m_render_origin.y);
-        offset.z = static_cast<float>(static_cast<double>(pos.z * static_cast<std::int32_t>(CHUNK_SIZE_Z)) - m_render_origin.z);
-        batch.chunk_offsets.push_back(offset);
+    for (const VisibleChunk& visible : m_visible_opaque) {
+        if (batch.chunk_offsets.size() >= MAX_DRAW_COMMANDS) {
+            break;
+        }
+        const ChunkGPUData& gpu_data = *visible.data;
+        emit(gpu_data, gpu_data.index_count, gpu_data.index_offset,
+             gpu_data.vertex_offset, batch.commands);
+
+        // AABB (camera-relative) for the GPU occlusion pass; bounds
+        // follow the sorted opaque command order
+        const ChunkPosition& pos = gpu_data.position;
+        const math::Vec3 bmin = box_corner(pos.x, pos.y, pos.z, m_render_origin);
+        const math::Vec3 bmax = box_corner(pos.x + 1, pos.y + 1, pos.z + 1, m_render_origin);
+        batch.bounds.insert(batch.bounds.end(),
+                            {bmin.x, bmin.y, bmin.z, 0.0f, bmax.x, bmax.y, bmax.z, 0.0f});
+    }
+    for (const VisibleChunk& visible : m_visible_translucent) {
+        const ChunkGPUData& gpu_data = *visible.data;
+        emit(gpu_data, gpu_data.translucent_index_count, gpu_data.translucent_index_offset,
+             gpu_data.translucent_vertex_offset, batch.translucent_commands);
+    }
 
-        // Note: In a true AZDO setup, we'd pack all chunk meshes into large buffers
-        // For now, we're using per-chunk VAOs for simplicity
+    if (batch.chunk_offsets.size() >= MAX_DRAW_COMMANDS) {
+        std::cerr << "[Renderer] Draw command limit reached (" << MAX_DRAW_COMMANDS << ")\n";
     }
 }
 
+// =============================================================================
+// HI-Z OCCLUSION PASS
+// =============================================================================
+
+bool Renderer::create_occlusion_resources() {
+    if (!m_hiz_shader.compile_compute(shaders::HIZ_DOWNSAMPLE_COMPUTE)) {
+        std::cerr << "[Renderer] Hi-Z downsample shader: " << m_hiz_shader.error() << "\n";
+        return false;
+    }
+    if (!m_cull_shader.compile_compute(shaders::OCCLUSION_CULL_COMPUTE)) {
+        std::cerr << "[Renderer] Occlusion cull shader: " << m_cull_shader.error() << "\n";
+        return false;
+    }
+
+    glCreateBuffers(1, &m_bounds_buffer);
+    glNamedBufferStorage(
+        m_bounds_buffer,
+        static_cast<GLsizeiptr>(MAX_DRAW_COMMANDS * 8 * sizeof(float)),
+        nullptr, GL_DYNAMIC_STORAGE_BIT);
+
+    return m_bounds_buffer != 0;
+}
+
+void Renderer::ensure_depth_pyramid(std::int32_t width, std::int32_t height) {
+    if (width == m_pyramid_width && height == m_pyramid_height && m_depth_pyramid != 0) {
+        return;
+    }
+
+    if (m_scene_depth != 0) {
+        glDeleteTextures(1, &m_scene_depth);
+    }
+    if (m_depth_pyramid != 0) {
+        glDeleteTextures(1, &m_depth_pyramid);
+    }
+
+    m_pyramid_width = width;
+    m_pyramid_height = height;
+    m_pyramid_valid = false;
+
+    // Full-resolution depth copy target
+    glCreateTextures(GL_TEXTURE_2D, 1, &m_scene_depth);
+    glTextureStorage2D(m_scene_depth, 1, GL_DEPTH_COMPONENT24, width, height);
+    glTextureParameteri(m_scene_depth, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTextureParameteri(m_scene_depth, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTextureParameteri(m_scene_depth, GL_TEXTURE_COMPARE_MODE, GL_NONE);
+
+    // Max-depth mip chain
+    std::int32_t mips = 1;
+    for (std::int32_t extent = std::max(width, height); extent > 1; extent >>= 1) {
+        ++mips;
+    }
+    m_pyramid_mips = mips;
+
+    glCreateTextures(GL_TEXTURE_2D, 1, &m_depth_pyramid);
+    glTextureStorage2D(m_depth_pyramid, mips, GL_R32F, width, height);
+    glTextureParameteri(m_depth_pyramid, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST);
+    glTextureParameteri(m_depth_pyramid, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTextureParameteri(m_depth_pyramid, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTextureParameteri(m_depth_pyramid, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+    std::cout << "[Renderer] Depth pyramid: " << width << "x" << height
+              << ", " << mips << " mips\n";
+}
+
+void Renderer::capture_depth_pyramid() {
+    GLint viewport[4] = {0, 0, 0, 0};
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    const std::int32_t width = viewport[2];
+    const std::int32_t height = viewport[3];
+    if (width <= 0 || height <= 0) {
+        return;
+    }
+
+    ensure_depth_pyramid(width, height);
+
+    // Copy the default framebuffer's depth into our texture
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+    glCopyTextureSubImage2D(m_scene_depth, 0, 0, 0, 0, 0, width, height);
+
+    // Build the max-depth mip chain
+    m_hiz_shader.bind();
+
+    std::int32_t mip_width = width;
+    std::int32_t mip_height = height;
+    for (std::int32_t level = 0; level < m_pyramid_mips; ++level) {
+        if (level == 0) {
+            // 1:1 copy from the captured scene depth
+            glBindTextureUnit(0, m_scene_depth);
+            m_hiz_shader.set_int("u_SrcLod", -1);
+        } else {
+            glBindTextureUnit(0, m_depth_pyramid);
+            m_hiz_shader.set_int("u_SrcLod", level - 1);
+        }
+
+        m_hiz_shader.set_int("u_DstWidth", mip_width);
+        m_hiz_shader.set_int("u_DstHeight", mip_height);
+
+        glBindImageTexture(0, m_depth_pyramid, level, GL_FALSE, 0, GL_WRITE_ONLY, GL_R32F);
+        glDispatchCompute(
+            static_cast<GLuint>((mip_width + 7) / 8),
+            static_cast<GLuint>((mip_height + 7) / 8),
+            1);
+        glMemoryBarrier(GL_SHADER_IMAGE_ACCESS_BARRIER_BIT | GL_TEXTURE_FETCH_BARRIER_BIT);
+
+        mip_width = std::max(mip_width >> 1, 1);
+        mip_height = std::max(mip_height >> 1, 1);
+    }
+
+    Shader::unbind();
+    m_pyramid_valid = true;
+}
+
+void Renderer::dispatch_occlusion_cull(const DrawBatch& batch) {
+    if (batch.commands.empty()) {
+        return;
+    }
+
+    // Upload this batch's AABBs
+    glNamedBufferSubData(
+        m_bounds_buffer, 0,
+        static_cast<GLsizeiptr>(batch.bounds.size() * sizeof(float)),
+        batch.bounds.data());
+
+    m_cull_shader.bind();
+    m_cull_shader.set_mat4("u_ViewProjection", m_view_projection);
+    m_cull_shader.set_uint("u_CommandCount", static_cast<std::uint32_t>(batch.commands.size()));
+    m_cull_shader.set_int("u_PyramidWidth", m_pyramid_width);
+    m_cull_shader.set_int("u_PyramidHeight", m_pyramid_height);
+    m_cull_shader.set_int("u_MipCount", m_pyramid_mips);
+
+    glBindTextureUnit(0, m_depth_pyramid);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, m_indirect_buffer.id());
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, m_bounds_buffer);
+
+    glDispatchCompute(static_cast<GLuint>((batch.commands.size() + 63) / 64), 1, 1);
+
+    // Commands must land before the indirect draw consumes them
+    glMemoryBarrier(GL_COMMAND_BARRIER_BIT);
+
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, 0);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, 0);
+}
+
 // =============================================================================
 // BLOCK HIGHLIGHT
 // =============================================================================
@@ -681,7 +1378,9 @@ void Renderer::render_block_highlight(std::int32_t block_x, std::int32_t block_y
 
     // Draw wireframe cube
     glBindVertexArray(m_highlight_vao);
+    m_gpu_timers.begin_pass(static_cast<std::uint32_t>(GpuPass::HIGHLIGHT));
     glDrawArrays(GL_LINES, 0, 24);  // 12 edges * 2 vertices each
+    m_gpu_timers.end_pass();
     glBindVertexArray(0);
 
     // Restore state
@@ -7,12 +7,38 @@
 
 #include <glad/glad.h>
 
+#include <cstdio>
+#include <filesystem>
 #include <fstream>
 #include <sstream>
 #include <iostream>
+#include <vector>
 
 namespace voxel::client {
 
+namespace {
+
+constexpr const char* SHADER_CACHE_DIR = "shader_cache";
+constexpr std::uint32_t SHADER_CACHE_MAGIC = 0x43535856;  // 'VXSC'
+
+// 64-bit FNV-1a over the shader sources and driver strings
+std::uint64_t fnv1a(std::uint64_t hash, std::string_view data) {
+    for (const char c : data) {
+        hash ^= static_cast<std::uint8_t>(c);
+        hash *= 0x100000001b3ull;
+    }
+    return hash;
+}
+
+std::filesystem::path cache_file_path(std::uint64_t key) {
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.bin",
+                  static_cast<unsigned long long>(key));
+    return std::filesystem::path(SHADER_CACHE_DIR) / name;
+}
+
+} // namespace
+
 // =============================================================================
 // CONSTRUCTOR / DESTRUCTOR
 // =============================================================================
@@ -54,10 +80,117 @@ void Shader::destroy() {
 // COMPILATION
 // =============================================================================
 
+std::uint64_t Shader::cache_key(std::string_view vertex_source,
+                                std::string_view fragment_source) {
+    std::uint64_t hash = 0xcbf29ce484222325ull;
+    hash = fnv1a(hash, vertex_source);
+    hash = fnv1a(hash, fragment_source);
+
+    // Fold in the driver identity so a driver update invalidates every
+    // cached binary (binary formats are driver-specific)
+    for (const GLenum name : {GL_VENDOR, GL_RENDERER, GL_VERSION}) {
+        const GLubyte* str = glGetString(name);
+        if (str) {
+            hash = fnv1a(hash, reinterpret_cast<const char*>(str));
+        }
+    }
+    return hash;
+}
+
+bool Shader::load_cached_binary(std::uint64_t key) {
+    // Skip entirely when the driver exposes no binary formats
+    GLint format_count = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &format_count);
+    if (format_count <= 0) {
+        return false;
+    }
+
+    std::ifstream file(cache_file_path(key), std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    std::uint32_t magic = 0;
+    GLenum format = 0;
+    std::uint32_t length = 0;
+    file.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+    file.read(reinterpret_cast<char*>(&format), sizeof(format));
+    file.read(reinterpret_cast<char*>(&length), sizeof(length));
+    if (!file || magic != SHADER_CACHE_MAGIC || length == 0) {
+        return false;
+    }
+
+    std::vector<char> binary(length);
+    file.read(binary.data(), static_cast<std::streamsize>(length));
+    if (!file) {
+        return false;
+    }
+
+    m_program = glCreateProgram();
+    glProgramBinary(m_program, format, binary.data(), static_cast<GLsizei>(length));
+
+    // The driver may reject a binary it produced (driver update, blob
+    // corruption); treat that as a cache miss and recompile
+    GLint success = 0;
+    glGetProgramiv(m_program, GL_LINK_STATUS, &success);
+    if (!success) {
+        glDeleteProgram(m_program);
+        m_program = 0;
+        return false;
+    }
+
+    LOG("Shader", "Loaded program ", m_program, " from binary cache");
+    return true;
+}
+
+void Shader::store_cached_binary(std::uint64_t key) const {
+    GLint format_count = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &format_count);
+    if (format_count <= 0) {
+        return;
+    }
+
+    GLint length = 0;
+    glGetProgramiv(m_program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) {
+        return;
+    }
+
+    std::vector<char> binary(static_cast<std::size_t>(length));
+    GLenum format = 0;
+    GLsizei written = 0;
+    glGetProgramBinary(m_program, length, &written, &format, binary.data());
+    if (written <= 0) {
+        return;
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(SHADER_CACHE_DIR, ec);
+
+    std::ofstream file(cache_file_path(key), std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        return;
+    }
+
+    const std::uint32_t magic = SHADER_CACHE_MAGIC;
+    const std::uint32_t blob_length = static_cast<std::uint32_t>(written);
+    file.write(reinterpret_cast<const char*>(&magic), sizeof(magic));
+    file.write(reinterpret_cast<const char*>(&format), sizeof(format));
+    file.write(reinterpret_cast<const char*>(&blob_length), sizeof(blob_length));
+    file.write(binary.data(), written);
+
+    LOG("Shader", "Cached program binary (", blob_length, " bytes)");
+}
+
 bool Shader::compile(std::string_view vertex_source, std::string_view fragment_source) {
     destroy();
     m_error.clear();
 
+    const std::uint64_t key = cache_key(vertex_source, fragment_source);
+    if (load_cached_binary(key)) {
+        return true;
+    }
+
     LOG("Shader", "Compiling shaders...");
     LOG("Shader", "Vertex shader size: ", vertex_source.size(), " chars");
     LOG("Shader", "Fragment shader size: ", fragment_source.size(), " chars");
@@ -83,6 +216,7 @@ bool Shader::compile(std::string_view vertex_source, std::string_view fragment_s
     m_program = glCreateProgram();
     glAttachShader(m_program, vertex_shader);
     glAttachShader(m_program, fragment_shader);
+    glProgramParameteri(m_program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
     glLinkProgram(m_program);
 
     // Check link status
@@ -111,6 +245,52 @@ bool Shader::compile(std::string_view vertex_source, std::string_view fragment_s
     glDeleteShader(vertex_shader);
     glDeleteShader(fragment_shader);
 
+    store_cached_binary(key);
+
+    return true;
+}
+
+bool Shader::compile_compute(std::string_view compute_source) {
+    destroy();
+    m_error.clear();
+
+    const std::uint64_t key = cache_key(compute_source, "compute");
+    if (load_cached_binary(key)) {
+        return true;
+    }
+
+    std::uint32_t compute_shader = compile_shader(GL_COMPUTE_SHADER, compute_source);
+    if (compute_shader == 0) {
+        LOG("Shader", "ERROR: Compute shader compilation failed: ", m_error);
+        return false;
+    }
+
+    m_program = glCreateProgram();
+    glAttachShader(m_program, compute_shader);
+    glProgramParameteri(m_program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    glLinkProgram(m_program);
+
+    GLint success;
+    glGetProgramiv(m_program, GL_LINK_STATUS, &success);
+    if (!success) {
+        GLint log_length;
+        glGetProgramiv(m_program, GL_INFO_LOG_LENGTH, &log_length);
+        m_error.resize(static_cast<std::size_t>(log_length));
+        glGetProgramInfoLog(m_program, log_length, nullptr, m_error.data());
+
+        LOG("Shader", "ERROR: Compute program linking failed: ", m_error);
+
+        glDeleteShader(compute_shader);
+        glDeleteProgram(m_program);
+        m_program = 0;
+        return false;
+    }
+
+    glDetachShader(m_program, compute_shader);
+    glDeleteShader(compute_shader);
+
+    store_cached_binary(key);
+
     return true;
 }
 
@@ -155,7 +335,9 @@ std::uint32_t Shader::compile_shader(std::uint32_t type, std::string_view source
         m_error.resize(static_cast<std::size_t>(log_length));
         glGetShaderInfoLog(shader, log_length, nullptr, m_error.data());
 
-        const char* type_str = (type == GL_VERTEX_SHADER) ? "VERTEX" : "FRAGMENT";
+        const char* type_str = (type == GL_VERTEX_SHADER) ? "VERTEX"
+                             : (type == GL_COMPUTE_SHADER) ? "COMPUTE"
+                             : "FRAGMENT";
         m_error = std::string(type_str) + " SHADER ERROR: " + m_error;
 
         glDeleteShader(shader);
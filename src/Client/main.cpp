@@ -9,15 +9,18 @@
 #include "Shared/Raycast.hpp"
 #include "Shared/Collision.hpp"
 #include "Shared/BlockRegistry.hpp"
+#include "Shared/ThreadPool.hpp"
 #include "Server/TickManager.hpp"
 #include "Server/World.hpp"
 #include "Server/WorldGenerator.hpp"
 #include "Server/GeneratorRegistry.hpp"
 #include "Server/FluidSimulator.hpp"
+#include "Server/LightEngine.hpp"
 #include "Client/Window.hpp"
 #include "Client/Camera.hpp"
 #include "Client/Renderer.hpp"
 #include "Client/MeshGenerator.hpp"
+#include "Client/ChunkStreamer.hpp"
 #include "Client/ImGuiDebugOverlay.hpp"
 
 #include <glad/glad.h>
@@ -26,9 +29,12 @@
 #include <backends/imgui_impl_glfw.h>
 #include <backends/imgui_impl_opengl3.h>
 
+#include <algorithm>
 #include <cstdio>
 #include <cmath>
 #include <chrono>
+#include <mutex>
+#include <unordered_set>
 #include <vector>
 #include <optional>
 
@@ -42,9 +48,15 @@ using namespace voxel::client;
 struct AppState {
     World* world = nullptr;
     FluidSimulator* fluid_sim = nullptr;  // Phase 4: Fluid simulation
+    LightEngine* light_engine = nullptr;  // Incremental flood-fill lighting
     Camera camera;
     Renderer renderer;
     MeshGenerator mesh_gen;
+
+    // Retained CPU meshes for edited chunks: after the first full rebuild
+    // a chunk's mesh stays cached, so later block edits splice only the
+    // touched slices instead of regenerating the whole 64^3 mesh
+    std::unordered_map<ChunkPosition, ChunkMesh> edited_meshes;
     ImGuiDebugOverlay debug_overlay;
 
     // Timing
@@ -240,13 +252,10 @@ void update_physics(AppState& app, Window& window) {
     double pos_y = cam_pos.y - CollisionResolver::PLAYER_EYE_HEIGHT; // Convert to feet position
     double pos_z = cam_pos.z;
     
-    // Lambda for voxel lookup
-    auto get_voxel = [&](std::int64_t bx, std::int64_t by, std::int64_t bz) -> Voxel {
-        return app.world->get_voxel(
-            static_cast<ChunkCoord>(bx),
-            static_cast<ChunkCoord>(by),
-            static_cast<ChunkCoord>(bz)
-        );
+    // Chunk lookup for the solidity-bitmask broadphase: one chunk-map
+    // access per column instead of one per sampled voxel
+    auto get_chunk = [&](ChunkCoord cx, ChunkCoord cy, ChunkCoord cz) -> const Chunk* {
+        return app.world->get_chunk(cx, cy, cz);
     };
     
     constexpr double HALF_WIDTH = CollisionResolver::PLAYER_WIDTH / 2.0;
@@ -260,7 +269,7 @@ void update_physics(AppState& app, Window& window) {
     // --- X AXIS ---
     if (std::abs(dx) > 0.0001) {
         double new_x = pos_x + dx;
-        if (CollisionResolver::would_collide(new_x, pos_y, pos_z, HALF_WIDTH, HALF_HEIGHT, get_voxel)) {
+        if (CollisionResolver::would_collide_cached(new_x, pos_y, pos_z, HALF_WIDTH, HALF_HEIGHT, get_chunk)) {
             // Snap to block edge
             if (dx > 0) {
                 // Moving +X: snap to left edge of blocking voxel
@@ -280,7 +289,7 @@ void update_physics(AppState& app, Window& window) {
     // --- Y AXIS ---
     if (std::abs(dy) > 0.0001) {
         double new_y = pos_y + dy;
-        if (CollisionResolver::would_collide(pos_x, new_y, pos_z, HALF_WIDTH, HALF_HEIGHT, get_voxel)) {
+        if (CollisionResolver::would_collide_cached(pos_x, new_y, pos_z, HALF_WIDTH, HALF_HEIGHT, get_chunk)) {
             if (dy < 0) {
                 // Moving down (falling): snap to top of blocking voxel
                 std::int64_t block_y = static_cast<std::int64_t>(std::floor(new_y));
@@ -300,7 +309,7 @@ void update_physics(AppState& app, Window& window) {
     // --- Z AXIS ---
     if (std::abs(dz) > 0.0001) {
         double new_z = pos_z + dz;
-        if (CollisionResolver::would_collide(pos_x, pos_y, new_z, HALF_WIDTH, HALF_HEIGHT, get_voxel)) {
+        if (CollisionResolver::would_collide_cached(pos_x, pos_y, new_z, HALF_WIDTH, HALF_HEIGHT, get_chunk)) {
             // Snap to block edge
             if (dz > 0) {
                 // Moving +Z: snap to near edge of blocking voxel
@@ -320,7 +329,7 @@ void update_physics(AppState& app, Window& window) {
     // Check if standing on ground (for next frame)
     // Test a small distance below feet
     if (!app.on_ground) {
-        if (CollisionResolver::would_collide(pos_x, pos_y - 0.01, pos_z, HALF_WIDTH, HALF_HEIGHT, get_voxel)) {
+        if (CollisionResolver::would_collide_cached(pos_x, pos_y - 0.01, pos_z, HALF_WIDTH, HALF_HEIGHT, get_chunk)) {
             app.on_ground = true;
             if (app.velocity_y < 0) {
                 app.velocity_y = 0.0;
@@ -458,6 +467,10 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
     WorldConfig world_config;
     world_config.seed = 12345;
     world_config.name = "render_test";
+    // Resident-chunk budget: well above the streaming footprint, so the
+    // LRU pass only trims the tail of chunks loaded by edits, fluid
+    // spread and past travel. Keeps long-session memory flat.
+    world_config.max_resident_chunks = 512;
 
     World world(world_config);
     
@@ -470,6 +483,23 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
     FluidSimulator fluid_sim(world);
     app.fluid_sim = &fluid_sim;
 
+    // Incremental lighting: block edits queue bounded BFS relights
+    LightEngine light_engine(world);
+    app.light_engine = &light_engine;
+
+    // Fixed-timestep scheduler: systems declare their interval, a phase
+    // slot to keep them off each other's ticks, and a soft budget
+    TickManager tick_manager;
+    tick_manager.register_system(
+        "fluids",
+        TickSystemConfig{FluidSimulator::FLUID_UPDATE_INTERVAL, 0, 2.0},
+        [&fluid_sim](double, std::uint64_t) { fluid_sim.tick(); });
+    tick_manager.register_system(
+        "lighting",
+        TickSystemConfig{LightEngine::LIGHT_UPDATE_INTERVAL, 0, 2.0},
+        [&light_engine](double, std::uint64_t) { light_engine.tick(); });
+    tick_manager.start();
+
     std::printf("Generator: %.*s\n",
         static_cast<int>(world.generator()->type_name().size()),
         world.generator()->type_name().data());
@@ -488,15 +518,17 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
 
     constexpr int LOAD_RADIUS = 4;
     std::vector<ChunkPosition> loaded_chunks;
-
     for (ChunkCoord cx = -LOAD_RADIUS; cx <= LOAD_RADIUS; ++cx) {
         for (ChunkCoord cz = -LOAD_RADIUS; cz <= LOAD_RADIUS; ++cz) {
-            if (world.load_chunk(cx, 0, cz)) {
-                loaded_chunks.push_back(ChunkPosition{cx, 0, cz});
-            }
+            loaded_chunks.push_back(ChunkPosition{cx, 0, cz});
         }
     }
-    
+
+    // Generate the whole startup grid in one batch: slices run on every
+    // pool worker and commit with bulk per-shard inserts
+    const std::size_t new_chunks = world.load_chunks_batch(loaded_chunks).get();
+    std::printf("Generated %zu new chunks\n", new_chunks);
+
     // Initialize fluid simulation for all loaded chunks (Phase 4)
     std::printf("\n--- Initializing Fluid Simulation ---\n");
     for (const auto& pos : loaded_chunks) {
@@ -507,10 +539,39 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
     }
     std::printf("Scheduled fluid updates for %zu chunks\n", loaded_chunks.size());
 
+    // Seed skylight and emitters before the first meshing pass, so the
+    // startup meshes bake real light levels instead of dark chunks
+    std::printf("\n--- Seeding Light ---\n");
+    for (const auto& pos : loaded_chunks) {
+        light_engine.initialize_chunk_light(pos);
+    }
+    light_engine.tick();
+    std::printf("Seeded light for %zu chunks\n", loaded_chunks.size());
+
     auto load_end = std::chrono::high_resolution_clock::now();
     auto load_time = std::chrono::duration_cast<std::chrono::milliseconds>(load_end - load_start);
     std::printf("Loaded %zu chunks in %lld ms\n", loaded_chunks.size(), static_cast<long long>(load_time.count()));
 
+    // Stream chunks around the camera from here on: nearest and on-screen
+    // first, a few async loads per frame, eviction beyond the unload
+    // radius. Newly resident chunks arrive marked dirty, so the dirty-mesh
+    // pass below builds and uploads their meshes
+    ChunkStreamer::Config stream_config;
+    stream_config.load_radius = LOAD_RADIUS;
+    stream_config.unload_radius = LOAD_RADIUS + 2;
+    ChunkStreamer streamer(world, stream_config);
+    streamer.mark_resident(loaded_chunks);
+    streamer.set_on_loaded([&app, &fluid_sim, &light_engine](ChunkPosition pos) {
+        if (const Chunk* chunk = app.world->get_chunk(pos)) {
+            fluid_sim.initialize_chunk_fluids(*chunk);
+        }
+        light_engine.initialize_chunk_light(pos);
+    });
+    streamer.set_on_unload([&app](ChunkPosition pos) {
+        app.renderer.remove_chunk_mesh(pos);
+        app.edited_meshes.erase(pos);
+    });
+
     // Generate meshes
     std::printf("\n--- Generating Meshes ---\n");
     auto mesh_start = std::chrono::high_resolution_clock::now();
@@ -549,6 +610,20 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
     std::printf("F4:       Toggle collision\n");
     std::printf("----------------\n\n");
 
+    // Dirty positions waiting for a mesh rebuild, carried across frames
+    // so integration can be cut off mid-backlog (set mirrors the vector
+    // for O(1) dedup of re-dirtied chunks)
+    std::vector<ChunkPosition> pending_remesh;
+    std::unordered_set<ChunkPosition> pending_remesh_set;
+
+    // Adaptive integration budget state: running per-rebuild cost and
+    // how much of last frame the integration pass itself consumed
+    constexpr double VSYNC_INTERVAL_MS = 1000.0 / 60.0;
+    constexpr double MESH_BUDGET_MIN_MS = 0.5;
+    constexpr double MESH_BUDGET_MAX_MS = 4.0;
+    double avg_remesh_ms = 0.5;
+    double last_integration_ms = 0.0;
+
     // Main loop
     app.last_time = Window::get_time();
 
@@ -567,10 +642,9 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
             app.fps_time = 0.0;
         }
         
-        // Tick fluid simulation (Phase 4: Modular Fluid Simulation)
-        if (app.fluid_sim) {
-            app.fluid_sim->tick();
-        }
+        // Fixed-timestep simulation: runs each registered system on its
+        // scheduled ticks (fluids every FLUID_UPDATE_INTERVAL)
+        [[maybe_unused]] const double tick_alpha = tick_manager.update();
 
         // Debug overlay (F3 style) - populate data struct for ImGui
         DebugOverlayData debug_data;
@@ -601,6 +675,19 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
             // Geometry stats (for greedy mesh verification)
             debug_data.total_vertices = static_cast<std::uint64_t>(app.renderer.total_vertices());
             debug_data.total_triangles = static_cast<std::uint64_t>(app.renderer.total_indices() / 3);
+            debug_data.draw_calls = static_cast<std::uint32_t>(app.renderer.draw_calls_last_frame());
+            debug_data.chunks_culled = static_cast<std::uint32_t>(app.renderer.chunks_culled_last_frame());
+
+            // Per-pass GPU timings from the renderer's timer queries
+            debug_data.gpu_pass_count = 0;
+            for (std::uint32_t p = 0;
+                 p < static_cast<std::uint32_t>(Renderer::GpuPass::COUNT) &&
+                 debug_data.gpu_pass_count < DebugOverlayData::MAX_GPU_PASSES; ++p) {
+                const auto pass = static_cast<Renderer::GpuPass>(p);
+                auto& out = debug_data.gpu_passes[debug_data.gpu_pass_count++];
+                std::snprintf(out.name, sizeof(out.name), "%s", Renderer::gpu_pass_name(pass));
+                out.gpu_ms = app.renderer.gpu_pass_ms(pass);
+            }
             
             // Player position
             debug_data.player_x = static_cast<float>(pos.x);
@@ -644,19 +731,17 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
             const math::Vec3& direction = app.camera.front();
 
             // Lambda to get voxel from world
-            auto get_voxel = [&](std::int64_t x, std::int64_t y, std::int64_t z) -> Voxel {
-                return app.world->get_voxel(
-                    static_cast<ChunkCoord>(x),
-                    static_cast<ChunkCoord>(y),
-                    static_cast<ChunkCoord>(z)
-                );
+            // Chunk-caching traversal: one chunk-map lookup per chunk
+            // crossing instead of one per voxel step
+            auto get_chunk = [&](ChunkCoord cx, ChunkCoord cy, ChunkCoord cz) -> const Chunk* {
+                return app.world->get_chunk(cx, cy, cz);
             };
 
-            app.targeted_block = VoxelRaycaster::cast(
+            app.targeted_block = VoxelRaycaster::cast_cached(
                 cam_pos.x, cam_pos.y, cam_pos.z,
                 direction.x, direction.y, direction.z,
                 app.player_reach,
-                get_voxel
+                get_chunk
             );
         }
 
@@ -675,6 +760,11 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
             if (app.fluid_sim) {
                 app.fluid_sim->notify_block_change(bx, by, bz);
             }
+
+            // Queue a bounded relight around the opened cell
+            if (app.light_engine) {
+                app.light_engine->notify_block_change(bx, by, bz);
+            }
         }
 
         // Block placing (Right Mouse Button)
@@ -714,23 +804,86 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
                 if (app.fluid_sim) {
                     app.fluid_sim->notify_block_change(place_x, place_y, place_z);
                 }
+
+                // Queue a bounded relight around the placed block
+                if (app.light_engine) {
+                    app.light_engine->notify_block_change(place_x, place_y, place_z);
+                }
+            }
+        }
+
+        // Stream chunks toward/away from the camera (bounded per frame)
+        streamer.update(app.camera);
+
+        // Enforce the resident-chunk budget: the stalest chunks beyond
+        // the unload radius are saved and dropped, along with their GPU
+        // meshes and retained CPU meshes
+        {
+            const WorldPosition& cam_pos = app.camera.position();
+            const ChunkPosition cam_chunk{
+                static_cast<ChunkCoord>(static_cast<std::int64_t>(std::floor(cam_pos.x)) >> 6),
+                static_cast<ChunkCoord>(static_cast<std::int64_t>(std::floor(cam_pos.y)) >> 6),
+                static_cast<ChunkCoord>(static_cast<std::int64_t>(std::floor(cam_pos.z)) >> 6)};
+            const auto evicted = app.world->evict_lru(cam_chunk, stream_config.unload_radius);
+            for (const ChunkPosition& pos : evicted) {
+                app.renderer.remove_chunk_mesh(pos);
+                app.edited_meshes.erase(pos);
             }
+            streamer.forget(evicted);
         }
 
-        // Rebuild dirty chunk meshes
+        // Collect newly dirtied chunks into the carry-over backlog.
+        // A chunk still pending from an earlier frame keeps accumulating
+        // dirty regions on the chunk itself, so deferral loses nothing
         if (app.world->has_dirty_chunks()) {
-            auto dirty_positions = app.world->consume_dirty_chunks();
-            
+            for (const auto& pos : app.world->consume_dirty_chunks()) {
+                if (pending_remesh_set.insert(pos).second) {
+                    pending_remesh.push_back(pos);
+                }
+            }
+        }
+
+        // Rebuild dirty chunk meshes under an adaptive time budget:
+        // consume backlog until the next rebuild (estimated at the
+        // running average cost) would overrun it, and carry the rest
+        // over. A handful of dense remeshes no longer blows the frame,
+        // and a backlog of cheap ones drains many per frame.
+        if (!pending_remesh.empty()) {
             // Create neighbor accessor for cross-chunk face culling
             auto neighbor_accessor = [&](ChunkCoord x, ChunkCoord y, ChunkCoord z) -> Voxel {
                 return app.world->get_voxel(x, y, z);
             };
-            
-            for (const auto& pos : dirty_positions) {
-                const Chunk* chunk = app.world->get_chunk(pos);
+
+            // Budget scales with headroom against the vsync interval:
+            // a frame already running hot integrates less, an idle one
+            // catches up faster
+            const double frame_ms = app.delta_time * 1000.0;
+            const double headroom_ms = VSYNC_INTERVAL_MS - (frame_ms - last_integration_ms);
+            const double budget_ms =
+                std::clamp(headroom_ms * 0.5, MESH_BUDGET_MIN_MS, MESH_BUDGET_MAX_MS);
+
+            const double integration_start = Window::get_time();
+            double spent_ms = 0.0;
+            std::size_t consumed = 0;
+            while (consumed < pending_remesh.size()) {
+                if (consumed > 0 && spent_ms + avg_remesh_ms > budget_ms) {
+                    break; // At least one rebuild per frame, then budget-gated
+                }
+                const ChunkPosition pos = pending_remesh[consumed++];
+                Chunk* chunk = app.world->get_chunk_mut(pos);
                 if (chunk) {
-                    ChunkMesh mesh;
-                    app.mesh_gen.generate(*chunk, mesh, neighbor_accessor);
+                    // Splice only the dirty slices into the retained mesh;
+                    // a chunk seen here for the first time (empty cache
+                    // entry) takes the full-rebuild fallback inside
+                    ChunkMesh& mesh = app.edited_meshes[pos];
+                    std::uint64_t regions = chunk->dirty_regions();
+                    if (regions == 0) {
+                        // Queued by a neighbor's border edit: contents
+                        // unchanged, but boundary-face visibility isn't
+                        regions = Chunk::BOUNDARY_REGIONS;
+                    }
+                    app.mesh_gen.generate_incremental(*chunk, mesh, regions, neighbor_accessor);
+                    chunk->clear_dirty();
                     if (!mesh.is_empty) {
                         app.renderer.upload_chunk_mesh(pos, mesh);
                     } else {
@@ -738,7 +891,23 @@ int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) {
                         app.renderer.remove_chunk_mesh(pos);
                     }
                 }
+                spent_ms = (Window::get_time() - integration_start) * 1000.0;
             }
+
+            // Exponential moving average of per-rebuild cost feeds the
+            // next frame's stopping decision
+            if (consumed > 0) {
+                avg_remesh_ms = avg_remesh_ms * 0.8 + (spent_ms / double(consumed)) * 0.2;
+            }
+            last_integration_ms = spent_ms;
+
+            for (std::size_t i = 0; i < consumed; ++i) {
+                pending_remesh_set.erase(pending_remesh[i]);
+            }
+            pending_remesh.erase(pending_remesh.begin(),
+                                 pending_remesh.begin() + static_cast<std::ptrdiff_t>(consumed));
+        } else {
+            last_integration_ms = 0.0;
         }
 
         // Render
@@ -0,0 +1,429 @@
+// =============================================================================
+// VOXEL ENGINE - REGION FILE IMPLEMENTATION
+// Memory-mapped chunk persistence (POSIX mmap / Win32 file mapping)
+// =============================================================================
+
+#include "Server/RegionFile.hpp"
+#include "Shared/ChunkCodec.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+
+#if defined(_WIN32)
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace voxel::server {
+
+namespace {
+
+// Records are padded so every record header starts 16-byte aligned
+constexpr std::uint64_t RECORD_ALIGN = 16;
+
+[[nodiscard]] constexpr std::uint64_t align_record(std::uint64_t offset) noexcept {
+    return (offset + RECORD_ALIGN - 1) & ~(RECORD_ALIGN - 1);
+}
+
+} // namespace
+
+// =============================================================================
+// REGION FILE - LIFECYCLE
+// =============================================================================
+
+RegionFile::RegionFile(std::string path)
+    : m_path(std::move(path))
+{
+    m_open = open_or_create();
+}
+
+RegionFile::~RegionFile() {
+    unmap();
+    close_file();
+}
+
+bool RegionFile::open_or_create() {
+#if defined(_WIN32)
+    HANDLE file = ::CreateFileA(
+        m_path.c_str(),
+        GENERIC_READ | GENERIC_WRITE,
+        FILE_SHARE_READ,
+        nullptr,
+        OPEN_ALWAYS,
+        FILE_ATTRIBUTE_NORMAL,
+        nullptr
+    );
+    if (file == INVALID_HANDLE_VALUE) {
+        std::fprintf(stderr, "[RegionFile] Failed to open: %s\n", m_path.c_str());
+        return false;
+    }
+    m_file = file;
+#else
+    m_fd = ::open(m_path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (m_fd < 0) {
+        std::fprintf(stderr, "[RegionFile] Failed to open: %s\n", m_path.c_str());
+        return false;
+    }
+#endif
+
+    m_index.assign(REGION_CHUNK_COUNT, IndexEntry{0, 0});
+
+    const std::uint64_t size = file_size();
+    if (size < DATA_OFFSET) {
+        // Fresh file - write header and an empty index table
+        FileHeader header{MAGIC, VERSION, 0};
+        if (!write_at(0, &header, sizeof(header)) ||
+            !write_at(INDEX_OFFSET, m_index.data(), REGION_CHUNK_COUNT * sizeof(IndexEntry))) {
+            std::fprintf(stderr, "[RegionFile] Failed to initialize: %s\n", m_path.c_str());
+            close_file();
+            return false;
+        }
+    }
+
+    if (!remap()) {
+        close_file();
+        return false;
+    }
+
+    // Validate header and pull the index table into memory
+    FileHeader header{};
+    std::memcpy(&header, m_map, sizeof(header));
+    if (header.magic != MAGIC || header.version != VERSION) {
+        std::fprintf(stderr, "[RegionFile] Bad header: %s\n", m_path.c_str());
+        unmap();
+        close_file();
+        return false;
+    }
+    std::memcpy(m_index.data(), m_map + INDEX_OFFSET, REGION_CHUNK_COUNT * sizeof(IndexEntry));
+
+    return true;
+}
+
+void RegionFile::close_file() noexcept {
+#if defined(_WIN32)
+    if (m_file) {
+        ::CloseHandle(static_cast<HANDLE>(m_file));
+        m_file = nullptr;
+    }
+#else
+    if (m_fd >= 0) {
+        ::close(m_fd);
+        m_fd = -1;
+    }
+#endif
+    m_open = false;
+}
+
+// =============================================================================
+// REGION FILE - MEMORY MAPPING
+// =============================================================================
+
+bool RegionFile::remap() {
+    unmap();
+
+    const std::uint64_t size = file_size();
+    if (size == 0) {
+        return false;
+    }
+
+#if defined(_WIN32)
+    HANDLE mapping = ::CreateFileMappingA(
+        static_cast<HANDLE>(m_file), nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        std::fprintf(stderr, "[RegionFile] CreateFileMapping failed: %s\n", m_path.c_str());
+        return false;
+    }
+    const void* view = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view) {
+        ::CloseHandle(mapping);
+        std::fprintf(stderr, "[RegionFile] MapViewOfFile failed: %s\n", m_path.c_str());
+        return false;
+    }
+    m_mapping = mapping;
+    m_map = static_cast<const std::uint8_t*>(view);
+#else
+    void* map = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, m_fd, 0);
+    if (map == MAP_FAILED) {
+        std::fprintf(stderr, "[RegionFile] mmap failed: %s\n", m_path.c_str());
+        return false;
+    }
+    m_map = static_cast<const std::uint8_t*>(map);
+#endif
+
+    m_map_size = size;
+    return true;
+}
+
+void RegionFile::unmap() noexcept {
+    if (!m_map) {
+        return;
+    }
+#if defined(_WIN32)
+    ::UnmapViewOfFile(m_map);
+    if (m_mapping) {
+        ::CloseHandle(static_cast<HANDLE>(m_mapping));
+        m_mapping = nullptr;
+    }
+#else
+    ::munmap(const_cast<std::uint8_t*>(m_map), m_map_size);
+#endif
+    m_map = nullptr;
+    m_map_size = 0;
+}
+
+// =============================================================================
+// REGION FILE - RAW I/O
+// =============================================================================
+
+bool RegionFile::write_at(std::uint64_t offset, const void* data, std::size_t size) {
+#if defined(_WIN32)
+    OVERLAPPED overlapped{};
+    overlapped.Offset = static_cast<DWORD>(offset & 0xFFFFFFFFu);
+    overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+    DWORD written = 0;
+    if (!::WriteFile(static_cast<HANDLE>(m_file), data,
+                     static_cast<DWORD>(size), &written, &overlapped)) {
+        return false;
+    }
+    return written == size;
+#else
+    const std::uint8_t* src = static_cast<const std::uint8_t*>(data);
+    std::size_t remaining = size;
+    auto pos = static_cast<off_t>(offset);
+    while (remaining > 0) {
+        const ssize_t written = ::pwrite(m_fd, src, remaining, pos);
+        if (written < 0) {
+            return false;
+        }
+        src += written;
+        pos += written;
+        remaining -= static_cast<std::size_t>(written);
+    }
+    return true;
+#endif
+}
+
+std::uint64_t RegionFile::file_size() const noexcept {
+#if defined(_WIN32)
+    LARGE_INTEGER size{};
+    if (!::GetFileSizeEx(static_cast<HANDLE>(m_file), &size)) {
+        return 0;
+    }
+    return static_cast<std::uint64_t>(size.QuadPart);
+#else
+    struct stat st{};
+    if (::fstat(m_fd, &st) != 0) {
+        return 0;
+    }
+    return static_cast<std::uint64_t>(st.st_size);
+#endif
+}
+
+bool RegionFile::write_index_entry(std::uint32_t index) {
+    const std::uint64_t offset = INDEX_OFFSET + index * sizeof(IndexEntry);
+    return write_at(offset, &m_index[index], sizeof(IndexEntry));
+}
+
+// =============================================================================
+// REGION FILE - CHUNK RECORDS
+// =============================================================================
+
+bool RegionFile::load_chunk(std::uint32_t index, Chunk& chunk) {
+    if (!m_open || index >= REGION_CHUNK_COUNT) {
+        return false;
+    }
+
+    std::lock_guard lock(m_mutex);
+
+    const IndexEntry entry = m_index[index];
+    if (entry.offset == 0) {
+        return false; // No record - caller generates
+    }
+
+    // Offsets are stored in 16-byte units so a full region (32768 dense
+    // records, ~32 GiB) stays addressable through a 32-bit index entry
+    const std::uint64_t record_offset = static_cast<std::uint64_t>(entry.offset) * RECORD_ALIGN;
+
+    // The writer may have appended since we last mapped
+    const std::uint64_t record_end = record_offset + sizeof(RecordHeader) + entry.size;
+    if (record_end > m_map_size && !remap()) {
+        return false;
+    }
+    if (record_end > m_map_size) {
+        return false; // Truncated record - treat as absent
+    }
+
+    RecordHeader header{};
+    std::memcpy(&header, m_map + record_offset, sizeof(header));
+    const std::uint8_t* payload = m_map + record_offset + sizeof(header);
+
+    chunk.allocate();
+
+    switch (static_cast<RecordMode>(header.mode)) {
+        case RecordMode::UNIFORM: {
+            if (header.size != sizeof(Voxel)) {
+                return false;
+            }
+            Voxel value{};
+            std::memcpy(&value, payload, sizeof(value));
+            chunk.fill(value);
+            return true;
+        }
+        case RecordMode::DENSE_RAW: {
+            if (header.size != Chunk::DATA_SIZE_BYTES) {
+                return false;
+            }
+            // Single copy out of the page cache into the dense tier,
+            // then settle into the smallest palette tier. The record
+            // covers the whole volume, so the dense buffer needs no
+            // zeroing beforehand.
+            std::memcpy(chunk.data_for_overwrite(), payload, Chunk::DATA_SIZE_BYTES);
+            chunk.compress();
+            return true;
+        }
+        case RecordMode::PALETTE_RLE: {
+            // Codec validates the record and settles the chunk into the
+            // smallest tier; a corrupt record is treated as absent
+            return chunk_codec::decode({payload, header.size}, chunk);
+        }
+        default:
+            return false;
+    }
+}
+
+bool RegionFile::save_chunk(std::uint32_t index, const Chunk& chunk) {
+    if (!m_open || index >= REGION_CHUNK_COUNT) {
+        return false;
+    }
+
+    std::lock_guard lock(m_mutex);
+
+    RecordHeader header{};
+    const void* payload = nullptr;
+
+    // Scratch buffer reused across saves on the writer thread
+    static thread_local std::vector<Voxel> scratch;
+
+    Voxel uniform_value{};
+    std::vector<std::uint8_t> encoded;
+    if (chunk.storage_mode() == Chunk::Storage::UNIFORM) {
+        header.mode = static_cast<std::uint32_t>(RecordMode::UNIFORM);
+        header.size = sizeof(Voxel);
+        uniform_value = chunk.get(0);
+        payload = &uniform_value;
+    } else if (encoded = chunk_codec::encode(chunk); !encoded.empty()) {
+        // Palette + RLE record: the common case, a few KiB instead of
+        // the 1 MiB dense array
+        header.mode = static_cast<std::uint32_t>(RecordMode::PALETTE_RLE);
+        header.size = static_cast<std::uint32_t>(encoded.size());
+        payload = encoded.data();
+    } else {
+        // Palette overflow (pathological noise): fall back to the raw
+        // dense record, copied out through get() so saving never
+        // densifies the chunk
+        scratch.resize(Chunk::VOLUME);
+        for (VoxelIndex i = 0; i < Chunk::VOLUME; ++i) {
+            scratch[i] = chunk.get(i);
+        }
+        header.mode = static_cast<std::uint32_t>(RecordMode::DENSE_RAW);
+        header.size = Chunk::DATA_SIZE_BYTES;
+        payload = scratch.data();
+    }
+
+    // Reuse the existing slot when the new record fits, otherwise append
+    IndexEntry& entry = m_index[index];
+    std::uint64_t offset;
+    if (entry.offset != 0 && header.size <= entry.size) {
+        offset = static_cast<std::uint64_t>(entry.offset) * RECORD_ALIGN;
+    } else {
+        offset = align_record(std::max<std::uint64_t>(file_size(), DATA_OFFSET));
+    }
+
+    if (!write_at(offset, &header, sizeof(header)) ||
+        !write_at(offset + sizeof(header), payload, header.size)) {
+        std::fprintf(stderr, "[RegionFile] Write failed: %s\n", m_path.c_str());
+        return false;
+    }
+
+    entry.offset = static_cast<std::uint32_t>(offset / RECORD_ALIGN);
+    entry.size = header.size;
+    return write_index_entry(index);
+}
+
+// =============================================================================
+// REGION MANAGER
+// =============================================================================
+
+RegionManager::RegionManager(std::string world_name)
+    : m_directory("saves/" + world_name)
+{
+    std::error_code ec;
+    std::filesystem::create_directories(m_directory, ec);
+    if (ec) {
+        std::fprintf(stderr, "[RegionManager] Failed to create %s: %s\n",
+                     m_directory.c_str(), ec.message().c_str());
+    }
+}
+
+RegionManager::~RegionManager() {
+    flush();
+}
+
+RegionFile* RegionManager::region_for(ChunkPosition pos) {
+    const RegionPosition region_pos = region::chunk_to_region(pos);
+
+    std::lock_guard lock(m_regions_mutex);
+
+    auto it = m_regions.find(region_pos);
+    if (it == m_regions.end()) {
+        char filename[96];
+        std::snprintf(filename, sizeof(filename), "/r.%lld.%lld.%lld.vxr",
+                      static_cast<long long>(region_pos.x),
+                      static_cast<long long>(region_pos.y),
+                      static_cast<long long>(region_pos.z));
+        auto file = std::make_unique<RegionFile>(m_directory + filename);
+        it = m_regions.emplace(region_pos, std::move(file)).first;
+    }
+
+    RegionFile* file = it->second.get();
+    return file->is_open() ? file : nullptr;
+}
+
+bool RegionManager::load_chunk(ChunkPosition pos, Chunk& chunk) {
+    RegionFile* file = region_for(pos);
+    if (!file) {
+        return false;
+    }
+    return file->load_chunk(region::chunk_to_region_index(pos), chunk);
+}
+
+void RegionManager::save_chunk_async(std::unique_ptr<Chunk> chunk) {
+    if (!chunk) {
+        return;
+    }
+    // shared_ptr: std::function requires copyable callables
+    std::shared_ptr<Chunk> shared = std::move(chunk);
+    m_writer.submit_detached([this, shared] {
+        save_chunk(*shared);
+    });
+}
+
+void RegionManager::save_chunk(const Chunk& chunk) {
+    RegionFile* file = region_for(chunk.position());
+    if (file) {
+        file->save_chunk(region::chunk_to_region_index(chunk.position()), chunk);
+    }
+}
+
+void RegionManager::flush() {
+    m_writer.wait_idle();
+}
+
+} // namespace voxel::server
@@ -5,8 +5,11 @@
 
 #include "Server/World.hpp"
 #include "Server/WorldGenerator.hpp"
+#include "Server/RegionFile.hpp"
+#include "Shared/ThreadPool.hpp"
 
 #include <algorithm>
+#include <cstdlib>
 #include <mutex>
 
 namespace voxel::server {
@@ -18,37 +21,54 @@ namespace voxel::server {
 World::World()
     : m_config{}
     , m_generator(nullptr)
-    , m_chunks{}
+    , m_regions(std::make_unique<RegionManager>(m_config.name))
 {}
 
 World::World(WorldConfig config)
     : m_config(config)
     , m_generator(nullptr)
-    , m_chunks{}
+    , m_regions(std::make_unique<RegionManager>(m_config.name))
 {}
 
 World::~World() {
     unload_all();
+    // Block until all queued write-backs have hit the OS
+    m_regions.reset();
 }
 
 World::World(World&& other) noexcept
     : m_config(other.m_config)
     , m_generator(std::move(other.m_generator))
-    , m_chunks(std::move(other.m_chunks))
-    , m_chunks_generated(other.m_chunks_generated)
-    , m_chunks_loaded(other.m_chunks_loaded)
-    , m_chunks_unloaded(other.m_chunks_unloaded)
-{}
+    , m_regions(std::move(other.m_regions))
+    , m_access_clock(other.m_access_clock.load())
+    , m_chunks_generated(other.m_chunks_generated.load())
+    , m_chunks_loaded(other.m_chunks_loaded.load())
+    , m_chunks_unloaded(other.m_chunks_unloaded.load())
+{
+    // Shards hold mutexes, so the array itself cannot move - transfer
+    // each shard's chunk map instead, same as move-assignment. Leaving
+    // them behind would strand every loaded chunk in the moved-from
+    // World with no RegionManager left to save them.
+    for (std::size_t i = 0; i < SHARD_COUNT; ++i) {
+        m_shards[i].chunks = std::move(other.m_shards[i].chunks);
+    }
+    m_heightmaps = std::move(other.m_heightmaps);
+}
 
 World& World::operator=(World&& other) noexcept {
     if (this != &other) {
         unload_all();
         m_config = other.m_config;
         m_generator = std::move(other.m_generator);
-        m_chunks = std::move(other.m_chunks);
-        m_chunks_generated = other.m_chunks_generated;
-        m_chunks_loaded = other.m_chunks_loaded;
-        m_chunks_unloaded = other.m_chunks_unloaded;
+        m_regions = std::move(other.m_regions);
+        for (std::size_t i = 0; i < SHARD_COUNT; ++i) {
+            m_shards[i].chunks = std::move(other.m_shards[i].chunks);
+        }
+        m_heightmaps = std::move(other.m_heightmaps);
+        m_access_clock = other.m_access_clock.load();
+        m_chunks_generated = other.m_chunks_generated.load();
+        m_chunks_loaded = other.m_chunks_loaded.load();
+        m_chunks_unloaded = other.m_chunks_unloaded.load();
     }
     return *this;
 }
@@ -65,8 +85,9 @@ void World::set_generator(std::unique_ptr<WorldGenerator> generator) {
 // =============================================================================
 
 const Chunk* World::get_chunk(ChunkPosition pos) const {
-    std::shared_lock lock(m_chunks_mutex);
-    return find_chunk_unlocked(pos);
+    const ChunkShard& shard = shard_for(pos);
+    std::shared_lock lock(shard.mutex);
+    return find_in_shard(shard, pos);
 }
 
 const Chunk* World::get_chunk(ChunkCoord x, ChunkCoord y, ChunkCoord z) const {
@@ -74,8 +95,9 @@ const Chunk* World::get_chunk(ChunkCoord x, ChunkCoord y, ChunkCoord z) const {
 }
 
 Chunk* World::get_chunk_mut(ChunkPosition pos) {
-    std::unique_lock lock(m_chunks_mutex);
-    return find_chunk_unlocked(pos);
+    ChunkShard& shard = shard_for(pos);
+    std::unique_lock lock(shard.mutex);
+    return find_in_shard(shard, pos);
 }
 
 Chunk* World::get_chunk_mut(ChunkCoord x, ChunkCoord y, ChunkCoord z) {
@@ -83,14 +105,97 @@ Chunk* World::get_chunk_mut(ChunkCoord x, ChunkCoord y, ChunkCoord z) {
 }
 
 bool World::has_chunk(ChunkPosition pos) const {
-    std::shared_lock lock(m_chunks_mutex);
-    return m_chunks.find(pos) != m_chunks.end();
+    const ChunkShard& shard = shard_for(pos);
+    std::shared_lock lock(shard.mutex);
+    return find_in_shard(shard, pos) != nullptr;
 }
 
 bool World::has_chunk(ChunkCoord x, ChunkCoord y, ChunkCoord z) const {
     return has_chunk(ChunkPosition{x, y, z});
 }
 
+std::shared_ptr<const PaddedChunkSnapshot> World::copy_padded_snapshot(ChunkPosition pos) const {
+    auto snap = std::make_shared<PaddedChunkSnapshot>();
+    snap->position = pos;
+
+    {
+        // Exclusive lock: Chunk::snapshot() may rebuild its cached copy,
+        // which must not race with another reader doing the same
+        const ChunkShard& shard = shard_for(pos);
+        std::unique_lock lock(shard.mutex);
+        const Chunk* chunk = find_in_shard(shard, pos);
+        if (chunk == nullptr) {
+            return nullptr;
+        }
+        snap->center = chunk->snapshot();
+    }
+
+    static constexpr ChunkCoord OFFSETS[6][3] = {
+        {-1, 0, 0}, {1, 0, 0}, {0, -1, 0}, {0, 1, 0}, {0, 0, -1}, {0, 0, 1}
+    };
+    constexpr auto SIZE = static_cast<LocalCoord>(CHUNK_SIZE_X);
+
+    for (std::size_t face = 0; face < 6; ++face) {
+        const ChunkPosition neighbor_pos{
+            pos.x + OFFSETS[face][0],
+            pos.y + OFFSETS[face][1],
+            pos.z + OFFSETS[face][2]
+        };
+
+        const ChunkShard& shard = shard_for(neighbor_pos);
+        std::shared_lock lock(shard.mutex);
+        const Chunk* neighbor = find_in_shard(shard, neighbor_pos);
+        if (neighbor == nullptr) {
+            continue;
+        }
+
+        // Copy the plane of the neighbor that touches this chunk
+        // (odd faces are positive directions, so the neighbor's 0-plane)
+        const LocalCoord fixed = (face & 1u) ? 0 : SIZE - 1;
+        std::vector<Voxel>& plane = snap->planes[face];
+        plane.resize(PaddedChunkSnapshot::PLANE_SIZE);
+
+        std::size_t out = 0;
+        switch (face >> 1) {
+            case 0: // X planes, indexed [y*64+z]
+                for (LocalCoord y = 0; y < SIZE; ++y) {
+                    for (LocalCoord z = 0; z < SIZE; ++z) {
+                        plane[out++] = neighbor->get(fixed, y, z);
+                    }
+                }
+                break;
+            case 1: // Y planes, indexed [x*64+z]
+                for (LocalCoord x = 0; x < SIZE; ++x) {
+                    for (LocalCoord z = 0; z < SIZE; ++z) {
+                        plane[out++] = neighbor->get(x, fixed, z);
+                    }
+                }
+                break;
+            default: // Z planes, indexed [x*64+y]
+                for (LocalCoord x = 0; x < SIZE; ++x) {
+                    for (LocalCoord y = 0; y < SIZE; ++y) {
+                        plane[out++] = neighbor->get(x, y, fixed);
+                    }
+                }
+                break;
+        }
+    }
+
+    return snap;
+}
+
+std::shared_ptr<const Voxel[]> World::copy_chunk_snapshot(ChunkPosition pos) const {
+    // Exclusive lock: Chunk::snapshot() may rebuild its cached copy,
+    // which must not race with writers or another reader doing the same
+    const ChunkShard& shard = shard_for(pos);
+    std::unique_lock lock(shard.mutex);
+    const Chunk* chunk = find_in_shard(shard, pos);
+    if (chunk == nullptr) {
+        return nullptr;
+    }
+    return chunk->snapshot();
+}
+
 // =============================================================================
 // CHUNK LIFECYCLE
 // =============================================================================
@@ -106,20 +211,22 @@ Chunk* World::load_chunk(ChunkPosition pos) {
         return nullptr;
     }
 
+    ChunkShard& shard = shard_for(pos);
+
     // First, check if chunk already exists (shared lock)
     {
-        std::shared_lock lock(m_chunks_mutex);
-        auto* existing = find_chunk_unlocked(pos);
+        std::shared_lock lock(shard.mutex);
+        auto* existing = find_in_shard(shard, pos);
         if (existing) {
             return existing;
         }
     }
 
-    // Chunk doesn't exist, need to create it (exclusive lock)
-    std::unique_lock lock(m_chunks_mutex);
+    // Chunk doesn't exist, need to create it (exclusive shard lock)
+    std::unique_lock lock(shard.mutex);
 
     // Double-check after acquiring exclusive lock
-    auto* existing = find_chunk_unlocked(pos);
+    auto* existing = find_in_shard(shard, pos);
     if (existing) {
         return existing;
     }
@@ -127,12 +234,18 @@ Chunk* World::load_chunk(ChunkPosition pos) {
     // Create new chunk
     auto chunk = std::make_unique<Chunk>(pos);
 
-    // Generate chunk data
-    generate_chunk(*chunk);
+    // Load from disk if a saved record exists, otherwise generate
+    if (m_regions && m_regions->load_chunk(pos, *chunk)) {
+        chunk->set_state(Chunk::State::LOADED);
+        merge_chunk_heights(*chunk);
+    } else {
+        generate_chunk(*chunk);
+    }
 
-    // Insert into map
+    // Insert into map (stamped so a fresh chunk is not the LRU victim)
     Chunk* result = chunk.get();
-    m_chunks.emplace(pos, std::move(chunk));
+    result->touch(m_access_clock.load(std::memory_order_relaxed));
+    shard.chunks.emplace(pos, std::move(chunk));
     ++m_chunks_loaded;
 
     return result;
@@ -142,21 +255,215 @@ Chunk* World::load_chunk(ChunkCoord x, ChunkCoord y, ChunkCoord z) {
     return load_chunk(ChunkPosition{x, y, z});
 }
 
+void World::load_chunk_async(ChunkPosition pos, LoadCallback callback) {
+    // Check bounds up front so callers get an immediate answer
+    if (!is_valid_chunk_y(pos.y) ||
+        !is_valid_world_pos(coord::chunk_to_world(pos.x), coord::chunk_to_world(pos.z))) {
+        if (callback) {
+            callback(nullptr);
+        }
+        return;
+    }
+
+    // Already loaded - complete synchronously
+    {
+        ChunkShard& shard = shard_for(pos);
+        std::shared_lock lock(shard.mutex);
+        auto* existing = find_in_shard(shard, pos);
+        if (existing) {
+            lock.unlock();
+            if (callback) {
+                callback(existing);
+            }
+            return;
+        }
+    }
+
+    // Deduplicate in-flight requests. The dropped caller still gets its
+    // callback (with nullptr): the exactly-once contract is what lets
+    // callers reclaim an in-flight slot for every request they issue.
+    {
+        std::unique_lock lock(m_pending_mutex);
+        if (!m_pending_loads.insert(pos).second) {
+            lock.unlock();
+            if (callback) {
+                callback(nullptr);
+            }
+            return;
+        }
+    }
+
+    global_thread_pool().submit_detached([this, pos, callback = std::move(callback)] {
+        // Generate into a detached chunk - no world lock held here, so
+        // an arbitrary number of generations overlap across workers
+        auto chunk = std::make_unique<Chunk>(pos);
+        if (m_regions && m_regions->load_chunk(pos, *chunk)) {
+            chunk->set_state(Chunk::State::LOADED);
+            merge_chunk_heights(*chunk);
+        } else {
+            generate_chunk(*chunk);
+        }
+
+        // Publish; on a lost race the already-present chunk wins
+        Chunk* published = chunk.get();
+        if (insert_chunk(pos, std::move(chunk))) {
+            ++m_chunks_loaded;
+        } else {
+            published = get_chunk_mut(pos);
+        }
+
+        {
+            std::lock_guard lock(m_pending_mutex);
+            m_pending_loads.erase(pos);
+        }
+
+        // Mark dirty so the mesh pipeline reacts as chunks arrive
+        mark_chunk_dirty(pos);
+
+        if (callback) {
+            callback(published);
+        }
+    });
+}
+
+bool World::is_load_pending(ChunkPosition pos) const {
+    std::lock_guard lock(m_pending_mutex);
+    return m_pending_loads.find(pos) != m_pending_loads.end();
+}
+
+std::future<std::size_t> World::load_chunks_batch(std::span<const ChunkPosition> positions) {
+    // Filter to positions that actually need work: in bounds, not a
+    // duplicate within the request, not already resident
+    std::vector<ChunkPosition> to_load;
+    to_load.reserve(positions.size());
+    {
+        std::unordered_set<ChunkPosition> seen;
+        seen.reserve(positions.size());
+        for (const ChunkPosition& pos : positions) {
+            if (!is_valid_chunk_y(pos.y) ||
+                !is_valid_world_pos(coord::chunk_to_world(pos.x), coord::chunk_to_world(pos.z))) {
+                continue;
+            }
+            if (!seen.insert(pos).second) {
+                continue;
+            }
+            ChunkShard& shard = shard_for(pos);
+            std::shared_lock lock(shard.mutex);
+            if (find_in_shard(shard, pos)) {
+                continue;
+            }
+            to_load.push_back(pos);
+        }
+    }
+
+    // Shared completion state: the last slice to finish fulfills the
+    // promise. No slice ever waits on another, so pool workers cannot
+    // deadlock running these tasks.
+    struct BatchState {
+        std::promise<std::size_t> promise;
+        std::atomic<std::size_t> remaining{0};
+        std::atomic<std::size_t> created{0};
+    };
+    auto state = std::make_shared<BatchState>();
+    std::future<std::size_t> future = state->promise.get_future();
+
+    if (to_load.empty()) {
+        state->promise.set_value(0);
+        return future;
+    }
+
+    const std::size_t slice_count = std::min(
+        std::max<std::size_t>(global_thread_pool().size(), 1), to_load.size());
+    state->remaining.store(slice_count, std::memory_order_relaxed);
+
+    for (std::size_t s = 0; s < slice_count; ++s) {
+        const std::size_t begin = (to_load.size() * s) / slice_count;
+        const std::size_t end   = (to_load.size() * (s + 1)) / slice_count;
+        std::vector<ChunkPosition> slice(to_load.begin() + static_cast<std::ptrdiff_t>(begin),
+                                         to_load.begin() + static_cast<std::ptrdiff_t>(end));
+
+        global_thread_pool().submit_detached([this, state, slice = std::move(slice)] {
+            // Generate into worker-local chunks - no world lock held, no
+            // state shared with the other slices
+            std::vector<std::pair<ChunkPosition, ChunkPtr>> ready;
+            ready.reserve(slice.size());
+            for (const ChunkPosition& pos : slice) {
+                auto chunk = std::make_unique<Chunk>(pos);
+                if (m_regions && m_regions->load_chunk(pos, *chunk)) {
+                    chunk->set_state(Chunk::State::LOADED);
+                    merge_chunk_heights(*chunk);
+                } else {
+                    generate_chunk(*chunk);
+                }
+                ready.emplace_back(pos, std::move(chunk));
+            }
+
+            // Commit grouped by shard: sort so each shard's chunks form a
+            // run, then insert every run under a single exclusive lock
+            std::sort(ready.begin(), ready.end(),
+                      [](const auto& a, const auto& b) {
+                          return (a.first.hash() & (SHARD_COUNT - 1))
+                               < (b.first.hash() & (SHARD_COUNT - 1));
+                      });
+
+            std::size_t created = 0;
+            std::size_t i = 0;
+            while (i < ready.size()) {
+                ChunkShard& shard = shard_for(ready[i].first);
+                std::unique_lock lock(shard.mutex);
+                const std::size_t shard_idx = ready[i].first.hash() & (SHARD_COUNT - 1);
+                while (i < ready.size() &&
+                       (ready[i].first.hash() & (SHARD_COUNT - 1)) == shard_idx) {
+                    // On a lost race the already-present chunk wins
+                    if (shard.chunks.find(ready[i].first) == shard.chunks.end()) {
+                        ready[i].second->touch(m_access_clock.load(std::memory_order_relaxed));
+                        shard.chunks.emplace(ready[i].first, std::move(ready[i].second));
+                        ++created;
+                    }
+                    ++i;
+                }
+            }
+
+            m_chunks_loaded += created;
+            state->created.fetch_add(created, std::memory_order_relaxed);
+
+            // Mark dirty after the shard locks are released
+            for (const auto& [pos, chunk] : ready) {
+                mark_chunk_dirty(pos);
+            }
+
+            if (state->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                state->promise.set_value(state->created.load(std::memory_order_relaxed));
+            }
+        });
+    }
+
+    return future;
+}
+
 bool World::unload_chunk(ChunkPosition pos) {
-    std::unique_lock lock(m_chunks_mutex);
+    ChunkShard& shard = shard_for(pos);
+    std::unique_lock lock(shard.mutex);
 
-    auto it = m_chunks.find(pos);
-    if (it == m_chunks.end()) {
+    auto it = shard.chunks.find(pos);
+    if (it == shard.chunks.end()) {
         return false;
     }
 
-    // TODO: Save chunk if dirty (Phase 3: Serialization)
-    // if (it->second->is_dirty()) {
-    //     save_chunk(*it->second);
-    // }
+    // Hand the chunk to the async write-back path; it is destroyed on
+    // the writer thread after the record is on disk
+    if (m_regions) {
+        m_regions->save_chunk_async(std::move(it->second));
+    }
 
-    m_chunks.erase(it);
+    shard.chunks.erase(it);
     ++m_chunks_unloaded;
+
+    // The unloaded chunk may have held the cached top of some columns -
+    // rebuild from whatever is still loaded (shard lock must be released
+    // first: the rebuild re-reads sibling chunks)
+    lock.unlock();
+    rebuild_column_heights(pos.x, pos.z);
     return true;
 }
 
@@ -169,31 +476,108 @@ bool World::insert_chunk(ChunkPosition pos, ChunkPtr chunk) {
         return false;
     }
 
-    std::unique_lock lock(m_chunks_mutex);
+    ChunkShard& shard = shard_for(pos);
+    std::unique_lock lock(shard.mutex);
 
     // Check if position already occupied
-    if (m_chunks.find(pos) != m_chunks.end()) {
+    if (shard.chunks.find(pos) != shard.chunks.end()) {
         return false;
     }
 
     chunk->set_position(pos);
-    m_chunks.emplace(pos, std::move(chunk));
+    Chunk* inserted = chunk.get();
+    inserted->touch(m_access_clock.load(std::memory_order_relaxed));
+    shard.chunks.emplace(pos, std::move(chunk));
+
+    // Fold the new chunk into the column heightmap outside the shard lock
+    lock.unlock();
+    merge_chunk_heights(*inserted);
     return true;
 }
 
 World::ChunkPtr World::remove_chunk(ChunkPosition pos) {
-    std::unique_lock lock(m_chunks_mutex);
+    ChunkShard& shard = shard_for(pos);
+    std::unique_lock lock(shard.mutex);
 
-    auto it = m_chunks.find(pos);
-    if (it == m_chunks.end()) {
+    auto it = shard.chunks.find(pos);
+    if (it == shard.chunks.end()) {
         return nullptr;
     }
 
     ChunkPtr chunk = std::move(it->second);
-    m_chunks.erase(it);
+    shard.chunks.erase(it);
+
+    lock.unlock();
+    rebuild_column_heights(pos.x, pos.z);
     return chunk;
 }
 
+// =============================================================================
+// LRU EVICTION
+// Long sessions keep loading chunks (streaming, edits, fluid spread)
+// but only the streamer's radius ever unloads them, so memory grows
+// with everywhere the player has been. This pass caps the resident set:
+// every chunk lookup stamps the access clock, and the stalest chunks
+// outside the retain radius are saved and dropped until the budget
+// holds again.
+// =============================================================================
+
+std::vector<ChunkPosition> World::evict_lru(ChunkPosition center, ChunkCoord retain_radius) {
+    std::vector<ChunkPosition> evicted;
+
+    // One clock tick per call: every lookup until the next call shares
+    // the new stamp, which is all the resolution eviction needs
+    m_access_clock.fetch_add(1, std::memory_order_relaxed);
+
+    const std::size_t budget = m_config.max_resident_chunks;
+    if (budget == 0) {
+        return evicted;
+    }
+    const std::size_t resident = chunk_count();
+    if (resident <= budget) {
+        return evicted;
+    }
+
+    // Candidates: chunks whose column lies outside the retain radius.
+    // Everything inside is pinned regardless of staleness - evicting
+    // under the player would immediately reload.
+    struct Candidate {
+        ChunkPosition pos;
+        std::uint64_t last_access;
+    };
+    std::vector<Candidate> candidates;
+    candidates.reserve(resident - budget);
+    for (const ChunkShard& shard : m_shards) {
+        std::shared_lock lock(shard.mutex);
+        for (const auto& [pos, chunk] : shard.chunks) {
+            if (std::abs(pos.x - center.x) <= retain_radius &&
+                std::abs(pos.z - center.z) <= retain_radius) {
+                continue;
+            }
+            candidates.push_back({pos, chunk->last_access()});
+        }
+    }
+    if (candidates.empty()) {
+        return evicted;
+    }
+
+    // Only the evictable prefix needs ordering, oldest stamps first
+    const std::size_t count = std::min(resident - budget, candidates.size());
+    std::partial_sort(
+        candidates.begin(), candidates.begin() + static_cast<std::ptrdiff_t>(count),
+        candidates.end(),
+        [](const Candidate& a, const Candidate& b) { return a.last_access < b.last_access; });
+
+    evicted.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        // unload_chunk queues the save, so edits survive eviction
+        if (unload_chunk(candidates[i].pos)) {
+            evicted.push_back(candidates[i].pos);
+        }
+    }
+    return evicted;
+}
+
 // =============================================================================
 // VOXEL ACCESS (Cross-Chunk)
 // =============================================================================
@@ -226,11 +610,12 @@ bool World::set_voxel(ChunkCoord world_x, ChunkCoord world_y, ChunkCoord world_z
         return false; // Out of bounds
     }
 
-    // Now get exclusive access to modify
-    std::unique_lock lock(m_chunks_mutex);
+    // Now get exclusive access to modify (only this chunk's shard)
+    ChunkShard& shard = shard_for(chunk_pos);
+    std::unique_lock lock(shard.mutex);
 
     // Re-find chunk under lock
-    Chunk* locked_chunk = find_chunk_unlocked(chunk_pos);
+    Chunk* locked_chunk = find_in_shard(shard, chunk_pos);
     if (!locked_chunk) {
         return false;
     }
@@ -240,11 +625,19 @@ bool World::set_voxel(ChunkCoord world_x, ChunkCoord world_y, ChunkCoord world_z
     LocalCoord local_y = world_to_local(world_y);
     LocalCoord local_z = world_to_local(world_z);
 
+    // The light nibbles are owned by the lighting engine, not by block
+    // writes: carry the stored levels through the edit so the queued
+    // relight still sees the pre-edit values its removal wave needs
+    constexpr std::uint32_t LIGHT_BITS = Voxel::SUNLIGHT_MASK | Voxel::TORCHLIGHT_MASK;
+    const Voxel previous = locked_chunk->get(local_x, local_y, local_z);
+    voxel.data = (voxel.data & ~LIGHT_BITS) | (previous.data & LIGHT_BITS);
+
     locked_chunk->set(local_x, local_y, local_z, voxel);
-    
+
     // Mark this chunk dirty for mesh rebuild
     // (unlock first to avoid deadlock with mark_chunk_dirty)
     lock.unlock();
+    update_column_height(world_x, world_y, world_z, !voxel.is_air());
     mark_chunk_dirty(chunk_pos);
     
     // Check if voxel is on chunk border - mark adjacent chunks dirty too
@@ -290,17 +683,23 @@ std::optional<Voxel> World::get_voxel_safe(ChunkCoord world_x, ChunkCoord world_
 // =============================================================================
 
 std::size_t World::chunk_count() const {
-    std::shared_lock lock(m_chunks_mutex);
-    return m_chunks.size();
+    std::size_t count = 0;
+    for (const ChunkShard& shard : m_shards) {
+        std::shared_lock lock(shard.mutex);
+        count += shard.chunks.size();
+    }
+    return count;
 }
 
 void World::for_each_chunk(ChunkConstCallback callback) const {
     if (!callback) return;
 
-    std::shared_lock lock(m_chunks_mutex);
-    for (const auto& [pos, chunk] : m_chunks) {
-        if (chunk) {
-            callback(*chunk);
+    for (const ChunkShard& shard : m_shards) {
+        std::shared_lock lock(shard.mutex);
+        for (const auto& [pos, chunk] : shard.chunks) {
+            if (chunk) {
+                callback(*chunk);
+            }
         }
     }
 }
@@ -308,34 +707,48 @@ void World::for_each_chunk(ChunkConstCallback callback) const {
 void World::for_each_chunk_mut(ChunkCallback callback) {
     if (!callback) return;
 
-    std::unique_lock lock(m_chunks_mutex);
-    for (auto& [pos, chunk] : m_chunks) {
-        if (chunk) {
-            callback(*chunk);
+    for (ChunkShard& shard : m_shards) {
+        std::unique_lock lock(shard.mutex);
+        for (auto& [pos, chunk] : shard.chunks) {
+            if (chunk) {
+                callback(*chunk);
+            }
         }
     }
 }
 
 std::vector<ChunkPosition> World::get_loaded_positions() const {
-    std::shared_lock lock(m_chunks_mutex);
-
     std::vector<ChunkPosition> positions;
-    positions.reserve(m_chunks.size());
+    positions.reserve(chunk_count());
 
-    for (const auto& [pos, chunk] : m_chunks) {
-        positions.push_back(pos);
+    for (const ChunkShard& shard : m_shards) {
+        std::shared_lock lock(shard.mutex);
+        for (const auto& [pos, chunk] : shard.chunks) {
+            positions.push_back(pos);
+        }
     }
 
     return positions;
 }
 
 void World::unload_all() {
-    std::unique_lock lock(m_chunks_mutex);
+    for (ChunkShard& shard : m_shards) {
+        std::unique_lock lock(shard.mutex);
+
+        if (m_regions) {
+            for (auto& [pos, chunk] : shard.chunks) {
+                if (chunk) {
+                    m_regions->save_chunk_async(std::move(chunk));
+                }
+            }
+        }
 
-    // TODO: Save dirty chunks (Phase 3)
+        m_chunks_unloaded += shard.chunks.size();
+        shard.chunks.clear();
+    }
 
-    m_chunks_unloaded += m_chunks.size();
-    m_chunks.clear();
+    std::unique_lock heightmap_lock(m_heightmap_mutex);
+    m_heightmaps.clear();
 }
 
 // =============================================================================
@@ -372,17 +785,39 @@ void World::generate_chunk(Chunk& chunk) {
         m_generator->generate(chunk);
         ++m_chunks_generated;
     }
+    // Generators write through the dense view - re-select the smallest
+    // storage tier (most chunks collapse to uniform or a small palette)
+    chunk.compress();
     chunk.set_state(Chunk::State::LOADED);
+
+    // Seed the column heightmap while the fresh voxel data is hot
+    merge_chunk_heights(chunk);
+}
+
+World::ChunkShard& World::shard_for(ChunkPosition pos) noexcept {
+    return m_shards[pos.hash() & (SHARD_COUNT - 1)];
 }
 
-const Chunk* World::find_chunk_unlocked(ChunkPosition pos) const {
-    auto it = m_chunks.find(pos);
-    return it != m_chunks.end() ? it->second.get() : nullptr;
+const World::ChunkShard& World::shard_for(ChunkPosition pos) const noexcept {
+    return m_shards[pos.hash() & (SHARD_COUNT - 1)];
 }
 
-Chunk* World::find_chunk_unlocked(ChunkPosition pos) {
-    auto it = m_chunks.find(pos);
-    return it != m_chunks.end() ? it->second.get() : nullptr;
+Chunk* World::find_in_shard(ChunkShard& shard, ChunkPosition pos) const {
+    auto it = shard.chunks.find(pos);
+    if (it == shard.chunks.end()) {
+        return nullptr;
+    }
+    it->second->touch(m_access_clock.load(std::memory_order_relaxed));
+    return it->second.get();
+}
+
+const Chunk* World::find_in_shard(const ChunkShard& shard, ChunkPosition pos) const {
+    auto it = shard.chunks.find(pos);
+    if (it == shard.chunks.end()) {
+        return nullptr;
+    }
+    it->second->touch(m_access_clock.load(std::memory_order_relaxed));
+    return it->second.get();
 }
 
 // =============================================================================
@@ -509,6 +944,137 @@ bool World::place_block(std::int64_t world_x, std::int64_t world_y, std::int64_t
     return true;
 }
 
+// =============================================================================
+// COLUMN HEIGHTMAP CACHE
+// =============================================================================
+
+std::optional<ChunkCoord> World::surface_height(ChunkCoord world_x, ChunkCoord world_z) const {
+    const ChunkPosition column{coord::world_to_chunk(world_x), 0, coord::world_to_chunk(world_z)};
+
+    std::shared_lock lock(m_heightmap_mutex);
+    auto it = m_heightmaps.find(column);
+    if (it == m_heightmaps.end()) {
+        return std::nullopt;
+    }
+    const ChunkCoord top =
+        it->second->top[column_index(world_to_local(world_x), world_to_local(world_z))];
+    if (top == COLUMN_EMPTY) {
+        return std::nullopt;
+    }
+    return top;
+}
+
+void World::merge_chunk_heights(const Chunk& chunk) {
+    if (chunk.is_empty()) {
+        return; // All air - contributes nothing to any column
+    }
+
+    // Scan outside the lock; most columns stop after one probe from the top
+    const ChunkPosition pos = chunk.position();
+    const ChunkCoord base_y = coord::chunk_to_world(pos.y);
+
+    std::array<ChunkCoord, CHUNK_SIZE_X * CHUNK_SIZE_Z> local_top;
+    local_top.fill(COLUMN_EMPTY);
+    for (LocalCoord x = 0; x < static_cast<LocalCoord>(CHUNK_SIZE_X); ++x) {
+        for (LocalCoord z = 0; z < static_cast<LocalCoord>(CHUNK_SIZE_Z); ++z) {
+            for (LocalCoord y = static_cast<LocalCoord>(CHUNK_SIZE_Y) - 1; y >= 0; --y) {
+                if (!chunk.get(x, y, z).is_air()) {
+                    local_top[column_index(x, z)] = base_y + y;
+                    break;
+                }
+            }
+        }
+    }
+
+    const ChunkPosition column{pos.x, 0, pos.z};
+    std::unique_lock lock(m_heightmap_mutex);
+    auto& entry = m_heightmaps[column];
+    if (!entry) {
+        entry = std::make_unique<ColumnHeights>();
+        entry->top.fill(COLUMN_EMPTY);
+    }
+    for (std::size_t i = 0; i < local_top.size(); ++i) {
+        entry->top[i] = std::max(entry->top[i], local_top[i]);
+    }
+}
+
+void World::update_column_height(ChunkCoord world_x, ChunkCoord world_y, ChunkCoord world_z, bool solid) {
+    const ChunkPosition column{coord::world_to_chunk(world_x), 0, coord::world_to_chunk(world_z)};
+    const std::size_t idx = column_index(world_to_local(world_x), world_to_local(world_z));
+
+    if (solid) {
+        // Placing at or above the cached top raises it; below, no change
+        std::unique_lock lock(m_heightmap_mutex);
+        auto& entry = m_heightmaps[column];
+        if (!entry) {
+            entry = std::make_unique<ColumnHeights>();
+            entry->top.fill(COLUMN_EMPTY);
+        }
+        if (entry->top[idx] == COLUMN_EMPTY || world_y > entry->top[idx]) {
+            entry->top[idx] = world_y;
+        }
+        return;
+    }
+
+    // Clearing a voxel only matters when it was the cached column top
+    {
+        std::shared_lock lock(m_heightmap_mutex);
+        auto it = m_heightmaps.find(column);
+        if (it == m_heightmaps.end() || it->second->top[idx] != world_y) {
+            return;
+        }
+    }
+
+    // Rescan downward with no heightmap lock held (the scan takes shard
+    // locks through get_chunk)
+    const ChunkCoord new_top = scan_column_top(world_x, world_z, world_y);
+
+    std::unique_lock lock(m_heightmap_mutex);
+    auto it = m_heightmaps.find(column);
+    if (it != m_heightmaps.end() && it->second->top[idx] == world_y) {
+        it->second->top[idx] = new_top;
+    }
+}
+
+void World::rebuild_column_heights(ChunkCoord chunk_x, ChunkCoord chunk_z) {
+    {
+        std::unique_lock lock(m_heightmap_mutex);
+        m_heightmaps.erase(ChunkPosition{chunk_x, 0, chunk_z});
+    }
+
+    // Re-merge whatever is still loaded in the column; if nothing is,
+    // the entry stays absent and surface_height reports unknown
+    for (ChunkCoord cy = m_config.max_chunk_y; cy >= m_config.min_chunk_y; --cy) {
+        if (const Chunk* chunk = get_chunk(ChunkPosition{chunk_x, cy, chunk_z})) {
+            merge_chunk_heights(*chunk);
+        }
+    }
+}
+
+ChunkCoord World::scan_column_top(ChunkCoord world_x, ChunkCoord world_z, ChunkCoord below_y) const {
+    const LocalCoord local_x = world_to_local(world_x);
+    const LocalCoord local_z = world_to_local(world_z);
+    const ChunkCoord min_y = coord::chunk_to_world(m_config.min_chunk_y);
+
+    ChunkCoord y = below_y - 1;
+    while (y >= min_y) {
+        const ChunkPosition chunk_pos = world_to_chunk_pos(world_x, y, world_z);
+        const ChunkCoord chunk_bottom = coord::chunk_to_world(chunk_pos.y);
+
+        const Chunk* chunk = get_chunk(chunk_pos);
+        if (!chunk || chunk->is_empty()) {
+            y = chunk_bottom - 1; // Skip the whole missing or all-air chunk
+            continue;
+        }
+        for (; y >= chunk_bottom; --y) {
+            if (!chunk->get(local_x, world_to_local(y), local_z).is_air()) {
+                return y;
+            }
+        }
+    }
+    return COLUMN_EMPTY;
+}
+
 // =============================================================================
 // DIRTY CHUNK TRACKING
 // =============================================================================
@@ -533,8 +1099,9 @@ void World::mark_chunk_dirty(ChunkPosition pos) {
     // Check if chunk exists first (with shared lock)
     bool exists = false;
     {
-        std::shared_lock lock(m_chunks_mutex);
-        exists = (m_chunks.find(pos) != m_chunks.end());
+        const ChunkShard& shard = shard_for(pos);
+        std::shared_lock lock(shard.mutex);
+        exists = (find_in_shard(shard, pos) != nullptr);
     }
     
     // Only mark if chunk actually exists
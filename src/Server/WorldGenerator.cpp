@@ -5,10 +5,123 @@
 
 #include "Server/WorldGenerator.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <cstring>
 
+#if defined(__AVX2__)
+    #include <immintrin.h>
+#endif
+
 namespace voxel::server {
 
+// =============================================================================
+// VALUE NOISE PRIMITIVES
+// Hash-based 2D value noise with quintic fade. The AVX2 path evaluates 8
+// columns per iteration; the scalar path is the reference implementation
+// and the fallback on non-AVX2 builds.
+// =============================================================================
+namespace {
+
+constexpr std::uint32_t HASH_PRIME_X  = 0x8DA6B343u;
+constexpr std::uint32_t HASH_PRIME_Z  = 0xD8163841u;
+constexpr std::uint32_t HASH_MIX      = 0x27D4EB2Du;
+constexpr std::uint32_t OCTAVE_STRIDE = 0x9E3779B9u;  // Decorrelates octaves
+
+// Hash a lattice point to a float in [-1, 1)
+[[nodiscard]] inline float lattice_value(std::int32_t xi, std::int32_t zi,
+                                         std::uint32_t seed) noexcept {
+    std::uint32_t h = static_cast<std::uint32_t>(xi) * HASH_PRIME_X
+                    ^ static_cast<std::uint32_t>(zi) * HASH_PRIME_Z
+                    ^ seed;
+    h = (h ^ (h >> 13)) * HASH_MIX;
+    h ^= h >> 15;
+    // Low 23 bits -> [0, 1) -> [-1, 1)
+    return static_cast<float>(h & 0x007FFFFFu) * (2.0f / 8388608.0f) - 1.0f;
+}
+
+// 2D value noise at (fx, fz), lattice spacing 1
+[[nodiscard]] inline float value_noise(float fx, float fz, std::uint32_t seed) noexcept {
+    const float x0f = std::floor(fx);
+    const float z0f = std::floor(fz);
+    const std::int32_t x0 = static_cast<std::int32_t>(x0f);
+    const std::int32_t z0 = static_cast<std::int32_t>(z0f);
+
+    const float tx = fx - x0f;
+    const float tz = fz - z0f;
+
+    // Quintic fade: t^3 * (t * (6t - 15) + 10)
+    const float ux = tx * tx * tx * (tx * (tx * 6.0f - 15.0f) + 10.0f);
+    const float uz = tz * tz * tz * (tz * (tz * 6.0f - 15.0f) + 10.0f);
+
+    const float c00 = lattice_value(x0,     z0,     seed);
+    const float c10 = lattice_value(x0 + 1, z0,     seed);
+    const float c01 = lattice_value(x0,     z0 + 1, seed);
+    const float c11 = lattice_value(x0 + 1, z0 + 1, seed);
+
+    const float top = c00 + (c10 - c00) * ux;
+    const float bot = c01 + (c11 - c01) * ux;
+    return top + (bot - top) * uz;
+}
+
+#if defined(__AVX2__)
+
+// Hash 8 lattice points to floats in [-1, 1)
+[[nodiscard]] inline __m256 lattice_value8(__m256i xi, __m256i zi,
+                                           std::uint32_t seed) noexcept {
+    __m256i h = _mm256_xor_si256(
+        _mm256_xor_si256(
+            _mm256_mullo_epi32(xi, _mm256_set1_epi32(static_cast<int>(HASH_PRIME_X))),
+            _mm256_mullo_epi32(zi, _mm256_set1_epi32(static_cast<int>(HASH_PRIME_Z)))),
+        _mm256_set1_epi32(static_cast<int>(seed)));
+    h = _mm256_mullo_epi32(_mm256_xor_si256(h, _mm256_srli_epi32(h, 13)),
+                           _mm256_set1_epi32(static_cast<int>(HASH_MIX)));
+    h = _mm256_xor_si256(h, _mm256_srli_epi32(h, 15));
+
+    const __m256 f = _mm256_cvtepi32_ps(
+        _mm256_and_si256(h, _mm256_set1_epi32(0x007FFFFF)));
+    return _mm256_sub_ps(_mm256_mul_ps(f, _mm256_set1_ps(2.0f / 8388608.0f)),
+                         _mm256_set1_ps(1.0f));
+}
+
+// 2D value noise for 8 x-positions sharing one z
+[[nodiscard]] inline __m256 value_noise8(__m256 fx, __m256 fz,
+                                         std::uint32_t seed) noexcept {
+    const __m256 x0f = _mm256_floor_ps(fx);
+    const __m256 z0f = _mm256_floor_ps(fz);
+    const __m256i x0 = _mm256_cvttps_epi32(x0f);
+    const __m256i z0 = _mm256_cvttps_epi32(z0f);
+    const __m256i one = _mm256_set1_epi32(1);
+
+    const __m256 tx = _mm256_sub_ps(fx, x0f);
+    const __m256 tz = _mm256_sub_ps(fz, z0f);
+
+    // Quintic fade: t^3 * (t * (6t - 15) + 10)
+    const __m256 six = _mm256_set1_ps(6.0f);
+    const __m256 fifteen = _mm256_set1_ps(15.0f);
+    const __m256 ten = _mm256_set1_ps(10.0f);
+    const __m256 ux = _mm256_mul_ps(
+        _mm256_mul_ps(_mm256_mul_ps(tx, tx), tx),
+        _mm256_add_ps(_mm256_mul_ps(tx, _mm256_sub_ps(_mm256_mul_ps(tx, six), fifteen)), ten));
+    const __m256 uz = _mm256_mul_ps(
+        _mm256_mul_ps(_mm256_mul_ps(tz, tz), tz),
+        _mm256_add_ps(_mm256_mul_ps(tz, _mm256_sub_ps(_mm256_mul_ps(tz, six), fifteen)), ten));
+
+    const __m256 c00 = lattice_value8(x0, z0, seed);
+    const __m256 c10 = lattice_value8(_mm256_add_epi32(x0, one), z0, seed);
+    const __m256 c01 = lattice_value8(x0, _mm256_add_epi32(z0, one), seed);
+    const __m256 c11 = lattice_value8(_mm256_add_epi32(x0, one),
+                                      _mm256_add_epi32(z0, one), seed);
+
+    const __m256 top = _mm256_add_ps(c00, _mm256_mul_ps(_mm256_sub_ps(c10, c00), ux));
+    const __m256 bot = _mm256_add_ps(c01, _mm256_mul_ps(_mm256_sub_ps(c11, c01), ux));
+    return _mm256_add_ps(top, _mm256_mul_ps(_mm256_sub_ps(bot, top), uz));
+}
+
+#endif // __AVX2__
+
+} // namespace
+
 // =============================================================================
 // SUPERFLAT GENERATOR
 // =============================================================================
@@ -127,6 +240,198 @@ ChunkCoord SuperflatGenerator::get_surface_height(
     return static_cast<ChunkCoord>(m_config.total_height());
 }
 
+// =============================================================================
+// NOISE TERRAIN GENERATOR
+// =============================================================================
+
+NoiseTerrainGenerator::NoiseTerrainGenerator()
+    : m_config(NoiseTerrainConfig::default_config())
+{}
+
+NoiseTerrainGenerator::NoiseTerrainGenerator(NoiseTerrainConfig config)
+    : m_config(config)
+{}
+
+void NoiseTerrainGenerator::set_config(NoiseTerrainConfig config) {
+    std::lock_guard<std::mutex> lock(m_cache_mutex);
+    m_config = config;
+    m_height_cache.clear();
+}
+
+std::shared_ptr<const NoiseTerrainGenerator::Heightmap>
+NoiseTerrainGenerator::column_heights(ChunkCoord cx, ChunkCoord cz) const {
+    const ChunkPosition key{cx, 0, cz};
+
+    std::lock_guard<std::mutex> lock(m_cache_mutex);
+    auto it = m_height_cache.find(key);
+    if (it != m_height_cache.end()) {
+        return it->second;
+    }
+
+    // Compute under the lock: a heightmap is ~100us, and this guarantees
+    // the vertical chunk range never computes the same column twice
+    auto heights = std::make_shared<Heightmap>();
+    compute_heightmap(cx, cz, *heights);
+
+    if (m_height_cache.size() >= MAX_CACHED_COLUMNS) {
+        m_height_cache.clear();
+    }
+    m_height_cache.emplace(key, heights);
+    return heights;
+}
+
+void NoiseTerrainGenerator::compute_heightmap(ChunkCoord cx, ChunkCoord cz,
+                                              Heightmap& out) const {
+    const ChunkCoord world_x_base = coord::chunk_to_world(cx);
+    const ChunkCoord world_z_base = coord::chunk_to_world(cz);
+    const std::uint32_t seed_lo = static_cast<std::uint32_t>(m_config.seed)
+                                ^ static_cast<std::uint32_t>(m_config.seed >> 32);
+
+    // Normalization so fbm stays in [-1, 1] regardless of octave count
+    float total_amplitude = 0.0f;
+    {
+        float amp = 1.0f;
+        for (std::uint32_t o = 0; o < m_config.octaves; ++o) {
+            total_amplitude += amp;
+            amp *= m_config.persistence;
+        }
+    }
+    const float inv_total = (total_amplitude > 0.0f) ? 1.0f / total_amplitude : 0.0f;
+
+    for (std::uint32_t z = 0; z < CHUNK_SIZE_Z; ++z) {
+        const float wz = static_cast<float>(world_z_base + static_cast<ChunkCoord>(z));
+        std::int32_t* row = out.data() + z * CHUNK_SIZE_X;
+
+#if defined(__AVX2__)
+        const __m256 lane_offsets = _mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f,
+                                                   4.0f, 5.0f, 6.0f, 7.0f);
+        for (std::uint32_t x = 0; x < CHUNK_SIZE_X; x += 8) {
+            const __m256 wx = _mm256_add_ps(
+                _mm256_set1_ps(static_cast<float>(world_x_base + static_cast<ChunkCoord>(x))),
+                lane_offsets);
+
+            __m256 sum = _mm256_setzero_ps();
+            float amp = 1.0f;
+            float freq = m_config.frequency;
+            for (std::uint32_t o = 0; o < m_config.octaves; ++o) {
+                const std::uint32_t octave_seed = seed_lo + o * OCTAVE_STRIDE;
+                const __m256 n = value_noise8(
+                    _mm256_mul_ps(wx, _mm256_set1_ps(freq)),
+                    _mm256_set1_ps(wz * freq),
+                    octave_seed);
+                sum = _mm256_add_ps(sum, _mm256_mul_ps(n, _mm256_set1_ps(amp)));
+                amp *= m_config.persistence;
+                freq *= m_config.lacunarity;
+            }
+
+            const __m256 height = _mm256_add_ps(
+                _mm256_set1_ps(static_cast<float>(m_config.base_height)),
+                _mm256_mul_ps(sum, _mm256_set1_ps(m_config.amplitude * inv_total)));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(row + x),
+                                _mm256_cvtps_epi32(height));
+        }
+#else
+        for (std::uint32_t x = 0; x < CHUNK_SIZE_X; ++x) {
+            const float wx = static_cast<float>(world_x_base + static_cast<ChunkCoord>(x));
+
+            float sum = 0.0f;
+            float amp = 1.0f;
+            float freq = m_config.frequency;
+            for (std::uint32_t o = 0; o < m_config.octaves; ++o) {
+                const std::uint32_t octave_seed = seed_lo + o * OCTAVE_STRIDE;
+                sum += amp * value_noise(wx * freq, wz * freq, octave_seed);
+                amp *= m_config.persistence;
+                freq *= m_config.lacunarity;
+            }
+
+            row[x] = static_cast<std::int32_t>(std::lround(
+                static_cast<float>(m_config.base_height)
+                + sum * m_config.amplitude * inv_total));
+        }
+#endif
+    }
+}
+
+void NoiseTerrainGenerator::generate(Chunk& chunk) {
+    const ChunkPosition& pos = chunk.position();
+    const ChunkCoord y_base = coord::chunk_to_world(pos.y);
+
+    // Entirely above the highest possible surface, or below the void floor
+    if (!should_generate(pos)) {
+        return;
+    }
+
+    const std::shared_ptr<const Heightmap> heights = column_heights(pos.x, pos.z);
+
+    Voxel* data = chunk.data();
+    const Voxel stone(VoxelType::STONE, 0, 0, 0);
+    const Voxel dirt(VoxelType::DIRT, 0, 0, 0);
+    const Voxel grass(VoxelType::GRASS, 0, 0, 0);
+
+    const auto clamp_local = [](ChunkCoord y) noexcept {
+        return static_cast<std::uint32_t>(std::clamp<ChunkCoord>(
+            y, 0, static_cast<ChunkCoord>(CHUNK_SIZE_Y)));
+    };
+
+    for (std::uint32_t x = 0; x < CHUNK_SIZE_X; ++x) {
+        for (std::uint32_t z = 0; z < CHUNK_SIZE_Z; ++z) {
+            const ChunkCoord surface = (*heights)[z * CHUNK_SIZE_X + x];
+
+            // Column layout (world Y): void below 0, stone up to the dirt
+            // band, dirt_depth of dirt, grass surface block at surface-1
+            const std::uint32_t col_bottom = clamp_local(-y_base);
+            const std::uint32_t stone_top  = clamp_local(
+                surface - 1 - static_cast<ChunkCoord>(m_config.dirt_depth) - y_base);
+            const std::uint32_t dirt_top   = clamp_local(surface - 1 - y_base);
+            const std::uint32_t grass_top  = clamp_local(surface - y_base);
+
+            if (grass_top <= col_bottom) {
+                continue;  // Column is air within this chunk
+            }
+
+            // Y is the fastest-varying index axis, so each span is contiguous
+            Voxel* column = data + coord::to_index(
+                static_cast<LocalCoord>(x), 0, static_cast<LocalCoord>(z));
+            std::fill(column + col_bottom, column + std::max(stone_top, col_bottom), stone);
+            std::fill(column + std::max(stone_top, col_bottom),
+                      column + std::max(dirt_top, col_bottom), dirt);
+            std::fill(column + std::max(dirt_top, col_bottom),
+                      column + grass_top, grass);
+        }
+    }
+
+    chunk.mark_dirty();
+}
+
+bool NoiseTerrainGenerator::should_generate(ChunkPosition pos) const noexcept {
+    const ChunkCoord y_base = coord::chunk_to_world(pos.y);
+
+    // Highest surface the fbm can produce
+    const ChunkCoord max_surface = static_cast<ChunkCoord>(m_config.base_height)
+        + static_cast<ChunkCoord>(std::ceil(m_config.amplitude)) + 1;
+    if (y_base >= max_surface) {
+        return false;
+    }
+
+    // Void below Y=0
+    if (y_base + static_cast<ChunkCoord>(CHUNK_SIZE_Y) <= 0) {
+        return false;
+    }
+
+    return true;
+}
+
+ChunkCoord NoiseTerrainGenerator::get_surface_height(
+    ChunkCoord world_x, ChunkCoord world_z) const noexcept
+{
+    const std::shared_ptr<const Heightmap> heights = column_heights(
+        coord::world_to_chunk(world_x), coord::world_to_chunk(world_z));
+
+    const std::uint32_t lx = static_cast<std::uint32_t>(coord::world_to_local(world_x));
+    const std::uint32_t lz = static_cast<std::uint32_t>(coord::world_to_local(world_z));
+    return (*heights)[lz * CHUNK_SIZE_X + lx];
+}
+
 // =============================================================================
 // GENERATOR FACTORY
 // =============================================================================
@@ -140,6 +445,12 @@ std::unique_ptr<WorldGenerator> create(std::string_view type_name, std::uint64_t
         return std::make_unique<SuperflatGenerator>(config);
     }
 
+    if (type_name == "noise_terrain" || type_name == "terrain") {
+        NoiseTerrainConfig config;
+        config.seed = seed;
+        return std::make_unique<NoiseTerrainGenerator>(config);
+    }
+
     // Default to superflat
     SuperflatConfig config;
     config.seed = seed;